@@ -273,6 +273,10 @@ project "orxpy"
         ["config"] = {"**.ini"}
     }
 
+    -- Lets the assembler find the binary bundle blob referenced by .incbin in the generated include ([Bundle] EmbedMode = Binary)
+    configuration {"not vs*"}
+        buildoptions {"-Wa,-I" .. path.rebase ("../include", os.getcwd (), os.getcwd () .. "/" .. destination)}
+
     configuration {"*Bundle*"}
         debugargs {"-b", "orxpy.obr"}
 
@@ -0,0 +1,2 @@
+def get_fixed_step() -> float: ...
+def get_alpha() -> float: ...
@@ -6,6 +6,7 @@ class Object:
 def create_object(name: str) -> Object | None: ...
 def delete_object(o: Object) -> None: ...
 
+# Pooled objects keep their GUID when recycled: a stored GUID will refer to the next spawn
 def get_guid(o: Object) -> int: ...
 def from_guid(guid: int) -> Object | None: ...
 
@@ -62,6 +63,15 @@ def apply_force(o: Object, force: Vector, point: Vector) -> None: ...
 def apply_impulse(o: Object, impulse: Vector, point: Vector) -> None: ...
 
 def raycast(begin: Vector, end: Vector, self_flags: int, check_mask: int, early_exit: bool = False) -> tuple[Object, Vector, Vector] | None: ...
+def raycast_many(begins: list[Vector], ends: list[Vector], self_flags: int, check_mask: int, early_exit: bool = False) -> tuple[list[Object | None], list[Vector | None], list[Vector | None]]: ...
+
+def find_in_box(min: Vector, max: Vector, group: str | None = None) -> list[Object]: ...
+def find_in_circle(center: Vector, radius: float, group: str | None = None) -> list[Object]: ...
+def find_nearest(position: Vector, count: int, group: str | None = None, max_distance: float | None = None) -> list[Object]: ...
+# Objects moved outside of this module (Object.SetPosition command, ...) can be missed by the find_* queries above until marked
+def mark_moved(o: Object) -> None: ...
+def pick_many(positions: list[Vector], group: str | None = None) -> list[Object | None]: ...
+def get_objects(section: str) -> list[Object]: ...
 
 def set_text_string(o: Object, s: str) -> None: ...
 def get_text_string(o: Object) -> str: ...
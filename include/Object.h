@@ -19,7 +19,6 @@ protected:
 
                 void            OnCreate();
                 void            OnDelete();
-                void            Update(const orxCLOCK_INFO &_rstInfo);
 
 
 private:
@@ -40,6 +40,8 @@
 #endif // __SCROLL_DEBUG__
 
 #include <new>
+#include <atomic>
+#include <thread>
 
 #include "ScrollObject.h"
 
@@ -121,6 +123,108 @@ struct ScrollIsPolymorphic
   enum {Value = (sizeof(Dummy1) == sizeof(Dummy2))};
 };
 
+template <class O>
+struct ScrollHasUpdate
+{
+  struct stNo
+  {
+  };
+
+  struct stYes
+  {
+    orxU32 u32Dummy;
+  };
+
+  typedef void (ScrollObject::*Update)(const orxCLOCK_INFO &);
+
+  template <Update> struct Check
+  {
+  };
+
+  // Only resolves when O inherits ScrollObject::Update as-is, overridden or inaccessible versions count as updatable
+  template <class T> static stNo  Test(Check<&T::Update> *);
+  template <class T> static stYes Test(...);
+  enum {Value = (sizeof(Test<O>(0)) == sizeof(stYes))};
+};
+
+template <class O>
+struct ScrollEventInterest
+{
+  struct stNo
+  {
+  };
+
+  struct stYes
+  {
+    orxU32 u32Dummy;
+  };
+
+  template <class M, M> struct Check
+  {
+  };
+
+  // Same rule as ScrollHasUpdate: only callbacks inherited as-is from ScrollObject are of no interest
+#define SCROLL_DECLARE_EVENT_TEST(NAME, RETURN, PARAMS)                                               \
+  template <class T> static stNo  Test##NAME(Check<RETURN (ScrollObject::*)PARAMS, &T::NAME> *);     \
+  template <class T> static stYes Test##NAME(...);
+
+  SCROLL_DECLARE_EVENT_TEST(OnRender,     orxBOOL,  (orxRENDER_EVENT_PAYLOAD &))
+  SCROLL_DECLARE_EVENT_TEST(OnShader,     orxBOOL,  (orxSHADER_EVENT_PAYLOAD &))
+  SCROLL_DECLARE_EVENT_TEST(OnCollide,    void,     (ScrollObject *, orxBODY_PART *, orxBODY_PART *, const orxVECTOR &, const orxVECTOR &))
+  SCROLL_DECLARE_EVENT_TEST(OnSeparate,   void,     (ScrollObject *, orxBODY_PART *, orxBODY_PART *))
+  SCROLL_DECLARE_EVENT_TEST(OnNewAnim,    void,     (const orxSTRING, const orxSTRING, orxBOOL))
+  SCROLL_DECLARE_EVENT_TEST(OnAnimUpdate, void,     (const orxSTRING))
+  SCROLL_DECLARE_EVENT_TEST(OnAnimEvent,  void,     (const orxSTRING, const orxSTRING, orxFLOAT, orxFLOAT))
+  SCROLL_DECLARE_EVENT_TEST(OnFXStart,    void,     (const orxSTRING, orxFX *))
+  SCROLL_DECLARE_EVENT_TEST(OnFXStop,     void,     (const orxSTRING, orxFX *))
+  SCROLL_DECLARE_EVENT_TEST(OnFXLoop,     void,     (const orxSTRING, orxFX *))
+
+#undef SCROLL_DECLARE_EVENT_TEST
+
+  enum {Value = ((sizeof(TestOnRender<O>(0)) == sizeof(stYes))     ? ScrollObject::EventFlagRender     : 0)
+              | ((sizeof(TestOnShader<O>(0)) == sizeof(stYes))     ? ScrollObject::EventFlagShader     : 0)
+              | ((sizeof(TestOnCollide<O>(0)) == sizeof(stYes))    ? ScrollObject::EventFlagCollide    : 0)
+              | ((sizeof(TestOnSeparate<O>(0)) == sizeof(stYes))   ? ScrollObject::EventFlagSeparate   : 0)
+              | ((sizeof(TestOnNewAnim<O>(0)) == sizeof(stYes))    ? ScrollObject::EventFlagNewAnim    : 0)
+              | ((sizeof(TestOnAnimUpdate<O>(0)) == sizeof(stYes)) ? ScrollObject::EventFlagAnimUpdate : 0)
+              | ((sizeof(TestOnAnimEvent<O>(0)) == sizeof(stYes))  ? ScrollObject::EventFlagAnimEvent  : 0)
+              | ((sizeof(TestOnFXStart<O>(0)) == sizeof(stYes))    ? ScrollObject::EventFlagFXStart    : 0)
+              | ((sizeof(TestOnFXStop<O>(0)) == sizeof(stYes))     ? ScrollObject::EventFlagFXStop     : 0)
+              | ((sizeof(TestOnFXLoop<O>(0)) == sizeof(stYes))     ? ScrollObject::EventFlagFXLoop     : 0)};
+};
+
+
+//! Deferred command, queued by parallel updates
+struct ScrollDeferredCommand
+{
+  enum Type
+  {
+    TypePosition = 0,
+    TypeRotation,
+    TypeScale,
+    TypeSpeed,
+    TypeColor,
+    TypeAnim,
+    TypeFX,
+    TypeLifeTime,
+    TypeCommand,
+
+    TypeNumber
+  };
+
+  orxU64          u64GUID;
+  Type            eType;
+  orxBOOL         bFlag;
+  orxBOOL         bRecursive;
+  union
+  {
+    orxVECTOR     vValue;
+    orxCOLOR      stColor;
+    orxFLOAT      fValue;
+    orxU32        u32StringOffset;
+  };
+};
+
 
 //! Object binder abstract class
 class ScrollObjectBinderBase
@@ -132,8 +236,11 @@ protected:
   static        orxHASHTABLE *          GetTable();
   static        void                    DeleteTable();
   static        ScrollObjectBinderBase *GetBinder(const orxSTRING _zName, orxBOOL _bAllowDefault = orxTRUE);
+  static        void                    ClearCache();
+  static        void                    SetPoolSize(const orxSTRING _zName, orxU32 _u32PoolSize);
+  static        orxU32                  GetPoolSize(const orxSTRING _zName);
 
-                                        ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u32ElementSize);
+                                        ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u32ElementSize, orxBOOL _bUpdate, orxU32 _u32EventFlags);
   virtual                              ~ScrollObjectBinderBase();
 
 
@@ -150,17 +257,30 @@ private:
 
                 ScrollObject *          GetNextObject(const ScrollObject *_poObject = orxNULL) const;
                 ScrollObject *          GetPreviousObject(const ScrollObject *_poObject = orxNULL) const;
+                orxU32                  GetObjectCount() const;
+                ScrollObject *          GetObjectAt(orxU32 _u32Index) const;
+                void                    AddIndexedObject(ScrollObject *_poObject);
+                void                    RemoveIndexedObject(ScrollObject *_poObject);
 
 
 //! Variables
 private:
 
   static  const orxU32                  su32TableSize;
+  static  const orxU32                  su32CacheTableSize;
 
                 orxBANK *               mpstBank;
                 ScrollObject *          mpoFirstObject;
                 ScrollObject *          mpoLastObject;
+                ScrollObject **         mapoObjectList;
+                orxU32                  mu32ObjectCount;
+                orxU32                  mu32ObjectSize;
+                orxBOOL                 mbUpdate;
+                orxU32                  mu32EventFlags;
   static        orxHASHTABLE *          spstTable;
+  static        orxHASHTABLE *          spstCacheTable;
+  static        orxHASHTABLE *          spstPoolSizeTable;
+  static        orxU32                  su32EventFlags;
 
 };
 
@@ -174,7 +294,7 @@ class ScrollObjectBinder : public ScrollObjectBinderBase
 public:
 
   static        ScrollObjectBinder<O> * GetInstance(orxS32 _s32SegmentSize = -1);
-  static        void                    Register(const orxSTRING _zModelName, orxS32 _s32SegmentSize);
+  static        void                    Register(const orxSTRING _zModelName, orxS32 _s32SegmentSize, orxU32 _u32PoolSize = 0);
 
 
 protected:
@@ -213,7 +333,7 @@ ScrollObjectBinder<O> *ScrollObjectBinder<O>::GetInstance(orxS32 _s32SegmentSize
 }
 
 template<class O>
-void ScrollObjectBinder<O>::Register(const orxSTRING _zName, orxS32 _s32SegmentSize)
+void ScrollObjectBinder<O>::Register(const orxSTRING _zName, orxS32 _s32SegmentSize, orxU32 _u32PoolSize)
 {
   // Checks
   orxASSERT(!orxHashTable_Get(ScrollObjectBinderBase::GetTable(), orxString_Hash(_zName)));
@@ -221,10 +341,20 @@ void ScrollObjectBinder<O>::Register(const orxSTRING _zName, orxS32 _s32SegmentS
 
   // Adds binder to table
   orxHashTable_Add(GetTable(), orxString_Hash(_zName ? _zName : orxSTRING_EMPTY), GetInstance(_s32SegmentSize));
+
+  // Invalidates resolved binders
+  ClearCache();
+
+  // Has pool?
+  if(_u32PoolSize != 0)
+  {
+    // Stores its size
+    SetPoolSize(_zName, _u32PoolSize);
+  }
 }
 
 template<class O>
-ScrollObjectBinder<O>::ScrollObjectBinder(orxS32 _s32SegmentSize) : ScrollObjectBinderBase(_s32SegmentSize, sizeof(O))
+ScrollObjectBinder<O>::ScrollObjectBinder(orxS32 _s32SegmentSize) : ScrollObjectBinderBase(_s32SegmentSize, sizeof(O), ScrollHasUpdate<O>::Value ? orxTRUE : orxFALSE, ScrollEventInterest<O>::Value)
 {
 }
 
@@ -245,7 +375,7 @@ ScrollObject *ScrollObjectBinder<O>::ConstructObject(orxBANK *_pstBank) const
 
 //! Scroll object bind helper
 template<class O>
-inline static void ScrollBindObject(const orxSTRING _zName, orxS32 _s32SegmentSize = 128)
+inline static void ScrollBindObject(const orxSTRING _zName, orxS32 _s32SegmentSize = 128, orxU32 _u32PoolSize = 0)
 {
 #ifdef __SCROLL_DEBUG__
   if(!ScrollIsA<O, ScrollObject>::Value)
@@ -255,7 +385,7 @@ inline static void ScrollBindObject(const orxSTRING _zName, orxS32 _s32SegmentSi
 #endif // __SCROLL_DEBUG__
 
   // Instances corresponding binder
-  ScrollObjectBinder<O>::Register(_zName, _s32SegmentSize);
+  ScrollObjectBinder<O>::Register(_zName, _s32SegmentSize, _u32PoolSize);
 }
 
 
@@ -263,6 +393,7 @@ inline static void ScrollBindObject(const orxSTRING _zName, orxS32 _s32SegmentSi
 class ScrollBase
 {
   friend class ScrollEd;
+  friend class ScrollObject;
   friend class ScrollObjectBinderBase;
 
 public:
@@ -277,6 +408,7 @@ public:
                 orxBOOL         IsGamePaused() const;
 
                 orxU32          GetFrameCount() const;
+                orxU32          GetSkippedEventCount() const;
 
                 orxVIEWPORT *   GetMainViewport() const;
                 orxCAMERA *     GetMainCamera() const;
@@ -287,11 +419,29 @@ public:
           template<class O> O * GetNextObject(const O *_poObject = orxNULL) const;
                 ScrollObject *  GetPreviousObject(const ScrollObject *_poObject = orxNULL, orxBOOL _bChronological = orxFALSE) const;
           template<class O> O * GetPreviousObject(const O *_poObject = orxNULL) const;
+                orxU32          GetObjectCount(const orxSTRING _zSectionName) const;
+          template<class O> orxU32 GetObjectCount() const;
+                ScrollObject *  GetObjectAt(const orxSTRING _zSectionName, orxU32 _u32Index) const;
+          template<class O> O * GetObjectAt(orxU32 _u32Index) const;
 
                 ScrollObject *  PickObject(const orxVECTOR &_rvPosition, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
                 ScrollObject *  PickObject(const orxVECTOR &_rvPosition, const orxVECTOR *_avOffsetList, orxU32 _u32ListSize, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
                 ScrollObject *  PickObject(const orxVECTOR &_rvPosition, const orxVECTOR &_rvExtent, orxSTRINGID _u32GroupID = orxSTRINGID_UNDEFINED) const;
                 ScrollObject *  PickObject(const orxOBOX &_rstBox, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
+                orxU32          PickObjects(const orxVECTOR *_avPositionList, orxU32 _u32Number, ScrollObject **_apoResultList, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
+
+                orxU32          FindObjects(const orxAABOX &_rstBox, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED);
+                orxU32          FindObjects(const orxVECTOR &_rvCenter, orxFLOAT _fRadius, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED);
+                orxU32          FindNearestObjects(const orxVECTOR &_rvPosition, orxOBJECT **_apstResultList, orxU32 _u32Number, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED, orxFLOAT _fMaxDistance = orxFLOAT_MAX);
+
+                // Recycled instances keep their orx GUID: a GUID stored before the deletion will refer to the next spawn
+                ScrollObject *  CreatePooledObject(const orxSTRING _zModelName);
+
+                void            ClearBinderCache();
+
+                // To call after moving an object outside of ScrollObject's setters (orxObject_SetPosition, Object.SetPosition command, ...), unless it has a body, a speed, a parent or an FX, or is updated
+                // Unmarked objects are only caught once a query visits the cell they were in, they can be missed by queries around their new position until then
+                void            MarkSpatialObject(orxOBJECT *_pstObject);
 
 
 
@@ -305,6 +455,8 @@ protected:
           const orxSTRING       GetMapShortName() const;
                 orxSTATUS       LoadMap();
                 orxSTATUS       SaveMap(orxBOOL _bEncrypt = orxFALSE, const orxCONFIG_SAVE_FUNCTION _pfnMapSaveFilter = orxNULL);
+                orxSTATUS       CompileMap(const orxSTRING _zMapName, const orxSTRING _zOutputName);
+                orxBOOL         IsCompiledMap() const;
                 orxSTATUS       ResetMap();
                 ScrollObject *  CreateObject(const orxSTRING _zModelName, ScrollObject::Flag _xFlags = ScrollObject::FlagNone, const orxSTRING _zInstanceName = orxNULL);
                 ScrollObject *  CreateObject(orxOBJECT *_pstOrxObject, ScrollObject::Flag _xFlags = ScrollObject::FlagNone, const orxSTRING _zInstanceName = orxNULL);
@@ -349,6 +501,17 @@ protected:
   static  const orxSTRING       szConfigScrollObjectSmoothing;
   static  const orxSTRING       szConfigScrollObjectTiling;
   static  const orxSTRING       szConfigScrollObjectPausable;
+  static  const orxSTRING       szConfigScrollObjectParallelUpdate;
+  static  const orxSTRING       szConfigScrollObjectPool;
+  static  const orxSTRING       szConfigScrollObjectLifeTime;
+  static  const orxSTRING       szConfigSectionScroll;
+  static  const orxSTRING       szConfigThreadNumber;
+  static  const orxSTRING       szConfigCellSize;
+  static  const orxSTRING       szConfigStreamMargin;
+  static  const orxSTRING       szConfigStreamBudget;
+  static  const orxSTRING       szConfigSpatialCellSize;
+  static  const orxSTRING       szConfigJournalSize;
+  static  const orxSTRING       szCommandCompileMap;
 
 
 private:
@@ -383,6 +546,41 @@ private:
 
                 orxSTATUS       AddObject(ScrollObject *_poObject);
                 orxSTATUS       RemoveObject(ScrollObject *_poObject);
+                void            AddUpdateObject(ScrollObject *_poObject);
+                void            RemoveUpdateObject(ScrollObject *_poObject);
+
+                orxSTATUS       StartWorkers();
+                void            StopWorkers();
+                void            RunParallelUpdate();
+                ScrollDeferredCommand *AddDeferredCommand(const ScrollObject *_poObject, ScrollDeferredCommand::Type _eType, const orxSTRING _zValue = orxNULL);
+                void            ApplyDeferredCommands();
+
+                orxSTATUS       LoadCompiledMap();
+
+                ScrollObject *  ReusePooledObject(const orxSTRING _zModelName, ScrollObject::Flag _xFlags, const orxSTRING _zInstanceName);
+                void            AddPooledObject(ScrollObject *_poObject);
+                void            RemovePooledObject(ScrollObject *_poObject);
+                orxSTATUS       RecycleObject(ScrollObject *_poObject);
+                void            UpdatePools(const orxCLOCK_INFO &_rstInfo);
+                void            DeletePools();
+                void            UpdateStreaming();
+                void            StopStreaming();
+                void            EnableSpatialHash();
+                void            RefreshSpatialHash();
+                void            DeleteSpatialHash();
+                void            FilterEvents();
+                void            AddSpatialObject(orxOBJECT *_pstObject);
+                void            RemoveSpatialObject(orxOBJECT *_pstObject);
+                void            LinkSpatialEntry(orxU32 _u32Index, orxU64 _u64CellKey);
+  static        orxBOOL         IsSpatialObjectDynamic(orxOBJECT *_pstObject);
+                void            UnlinkSpatialEntry(orxU32 _u32Index);
+                orxU32          FindSpatialObjects(const orxVECTOR &_rvMin, const orxVECTOR &_rvMax, const orxVECTOR *_pvCenter, orxFLOAT _fSquareRadius, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID);
+                orxU64          GetSpatialCellKey(const orxVECTOR &_rvPosition) const;
+                orxS32          GetSpatialCell(orxFLOAT _fCoordinate) const;
+                void            StoreMapObject(ScrollObject *_poObject);
+                void            ResetJournal(orxU32 _u32BaseCount, orxBOOL _bValid);
+                void            AddJournalSection(const orxSTRING _zSectionName);
+                const orxSTRING GetJournalName(orxCHAR *_acBuffer, orxU32 _u32Size) const;
 
   static  void                  DeleteInstance();
 
@@ -394,6 +592,8 @@ private:
   static  orxBOOL   orxFASTCALL StaticMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption);
   static  orxSTATUS orxFASTCALL StaticEventHandler(const orxEVENT *_pstEvent);
   static  orxSTATUS orxFASTCALL StaticBootstrap();
+  static  orxSTATUS orxFASTCALL StaticWorker(void *_pContext);
+  static  void      orxFASTCALL StaticCompileMapCommand(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult);
 
 
 //! Variables
@@ -403,21 +603,216 @@ protected:
 
 private:
 
+  struct ParallelObject
+  {
+    ScrollObject *        poObject;
+    const orxCLOCK_INFO * pstClockInfo;
+  };
+
+  struct ObjectPool
+  {
+    ScrollObject **         apoFreeList;
+    ScrollObject **         apoActiveList;
+    orxU32                  u32FreeCount;
+    orxU32                  u32ActiveCount;
+    orxU32                  u32ActiveSize;
+    orxU32                  u32Size;
+  };
+
+                ObjectPool *    GetPool(const orxSTRING _zModelName);
+
+  struct DeferredCommandList
+  {
+    ScrollDeferredCommand * astCommandList;
+    orxCHAR *               acStringBuffer;
+    orxU32                  u32Count;
+    orxU32                  u32Size;
+    orxU32                  u32StringCount;
+    orxU32                  u32StringSize;
+  };
+
+  enum CompiledMapFlag
+  {
+    CompiledMapFlagDifferential     = 0x00000001,
+    CompiledMapFlagLayerNumber      = 0x00000002,
+    CompiledMapFlagCameraPosition   = 0x00000004,
+    CompiledMapFlagCameraZoom       = 0x00000008,
+
+    CompiledObjectFlagColor         = 0x00000001,
+    CompiledObjectFlagSmoothing     = 0x00000002,
+    CompiledObjectFlagTiling        = 0x00000004,
+    CompiledObjectFlagDeleted       = 0x00000008
+  };
+
+  struct CompiledMapHeader
+  {
+    orxU32                  u32Magic;
+    orxU32                  u32ObjectNumber;
+    orxU32                  u32StringSize;
+    orxU32                  u32Flags;
+    orxU32                  u32LayerNumber;
+    orxU32                  u32CellNumber;
+    orxFLOAT                fCellSize;
+    orxVECTOR               vCameraPosition;
+    orxFLOAT                fCameraZoom;
+  };
+
+  struct CompiledMapCell
+  {
+    orxS32                  s32X;
+    orxS32                  s32Y;
+    orxU32                  u32First;
+    orxU32                  u32Count;
+  };
+
+  struct CompiledMapObject
+  {
+    orxU32                  u32ModelOffset;
+    orxU32                  u32ID;
+    orxU32                  u32Flags;
+    orxVECTOR               vPosition;
+    orxVECTOR               vScale;
+    orxFLOAT                fRotation;
+    orxCOLOR                stColor;
+  };
+
+  struct CompiledMap
+  {
+    CompiledMapHeader       stHeader;
+    CompiledMapCell *       astCellList;
+    CompiledMapObject *     astObjectList;
+    orxCHAR *               acStringList;
+    orxHASHTABLE *          pstStringTable;
+    orxU32                  u32ObjectSize;
+    orxU32                  u32StringCapacity;
+  };
+
+  struct StreamCell
+  {
+    orxU32 *                au32EntryList;
+    orxU64 *                au64GUIDList;
+    orxS32                  s32X;
+    orxS32                  s32Y;
+    orxU32                  u32Count;
+    orxU32                  u32Size;
+    orxU32                  u32Loaded;
+    orxU32                  u32Stamp;
+  };
+
+  struct SpatialEntry
+  {
+    orxOBJECT *             pstObject;
+    orxVECTOR               vPosition;
+    orxU64                  u64CellKey;
+    orxU32                  u32Previous;
+    orxU32                  u32Next;
+    orxBOOL                 bPending;
+    orxBOOL                 bDynamic;
+  };
+
+  struct SpatialList
+  {
+    orxU64 *                au64GUIDList;
+    orxU32                  u32Count;
+    orxU32                  u32Size;
+  };
+
+  static        void            AddSpatialGUID(SpatialList &_rstList, orxU64 _u64GUID);
+                void            GetSpatialPosition(const SpatialEntry &_rstEntry, orxVECTOR &_rvPosition);
+
+  static        orxU64          GetCellKey(orxS32 _s32X, orxS32 _s32Y)           {return ((orxU64)(orxU32)_s32X << 32) | (orxU64)(orxU32)_s32Y;}
+  static        void            PartitionCompiledMap(CompiledMap &_rstMap);
+                ScrollObject *  CreateCompiledMapObject(const CompiledMapObject &_rstEntry, const orxCHAR *_acStringList);
+                StreamCell *    GetStreamCell(orxS32 _s32X, orxS32 _s32Y);
+                void            ActivateStreamCell(StreamCell &_rstCell);
+                void            UnloadStreamCell(StreamCell &_rstCell);
+  static        void            AddStreamEntry(StreamCell &_rstCell, orxU32 _u32Entry, orxU64 _u64GUID);
+
+  static        orxSTATUS       ValidateCompiledMap(const CompiledMapHeader &_rstHeader, const CompiledMapCell *_astCellList, const CompiledMapObject *_astObjectList, const orxCHAR *_acStringList);
+
+  static        CompiledMapObject *AddCompiledMapObject(CompiledMap &_rstMap, const orxSTRING _zModelName, orxU32 _u32ID);
+  static        orxSTATUS       WriteCompiledMap(CompiledMap &_rstMap, const orxSTRING _zFileName);
+
+  static  const orxU32          su32UpdateListSize;
+  static  const orxU32          su32ParallelChunkSize;
+  static  const orxU32          su32CompiledMapMagic;
+  static  const orxU32          su32StreamBudget;
+  static  const orxFLOAT        sfSpatialCellSize;
+  static  const orxFLOAT        sfSpatialCellLimit;
+  static  const orxSTRING       szMapJournalSuffix;
+
                 orxLINKLIST     mstObjectList;
                 orxLINKLIST     mstObjectChronoList;
+                ScrollObject ** mapoUpdateList;
+                ParallelObject *mastParallelList;
+                ObjectPool **   mapstPoolList;
+                orxHASHTABLE *  mpstPoolTable;
+                DeferredCommandList mastDeferredList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+                orxU32          mau32WorkerList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+                orxTHREAD_SEMAPHORE *mpstWorkSemaphore;
+                orxTHREAD_SEMAPHORE *mpstDoneSemaphore;
+                std::atomic<orxU32> mu32ParallelCursor;
                 orxSTRING       mzMapName;
                 const orxSTRING mzCurrentCreateObject;
                 const orxSTRING mzCurrentDeleteObject;
                 orxVIEWPORT *   mpstMainViewport;
                 orxCAMERA *     mpstMainCamera;
                 orxCONFIG_SAVE_FUNCTION mpfnCustomMapSaveFilter;
+                orxU8 *         mpu8StreamData;
+                CompiledMapObject *mastStreamObjectList;
+                const orxCHAR * macStreamStringList;
+                orxBANK *       mpstStreamCellBank;
+                StreamCell **   mapstStreamActiveList;
+                orxHASHTABLE *  mpstStreamCellTable;
+                SpatialEntry *  mastSpatialList;
+                SpatialList     mstSpatialPendingList;
+                SpatialList     mstSpatialDynamicList;
+                orxHASHTABLE *  mpstSpatialCellTable;
+                orxHASHTABLE *  mpstSpatialObjectTable;
+                orxFLOAT *      mafSpatialDistanceList;
+                orxHASHTABLE *  mpstJournalTable;
+                orxFLOAT        mfSpatialCellSize;
+                orxFLOAT        mfStreamCellSize;
+                orxFLOAT        mfStreamMargin;
+                orxS32          ms32StreamMinX;
+                orxS32          ms32StreamMinY;
+                orxS32          ms32StreamMaxX;
+                orxS32          ms32StreamMaxY;
+                orxU32          mu32StreamActiveSize;
+                orxU32          mu32StreamActiveCount;
+                orxU32          mu32StreamBudget;
+                orxU32          mu32StreamStamp;
+                orxU32          mu32SpatialCount;
+                orxU32          mu32SpatialSize;
+                orxU32          mu32SpatialDistanceSize;
+                orxU32          mu32SpatialStamp;
+                orxU32          mu32JournalSize;
+                orxU32          mu32JournalBaseCount;
+                orxU32          mu32JournalBaseID;
+                orxU32          mu32JournalNewCount;
                 orxU32          mu32NextObjectID;
                 orxU32          mu32RuntimeObjectID;
                 orxU32          mu32LayerNumber;
                 orxU32          mu32FrameCount;
+                orxU32          mu32SkippedEventCount;
+                orxU32          mu32UpdateCount;
+                orxU32          mu32UpdateSize;
+                orxU32          mu32PoolCount;
+                orxU32          mu32PoolSize;
+                orxU32          mu32ParallelCount;
+                orxU32          mu32ParallelSize;
+                orxU32          mu32WorkerCount;
                 orxBOOL         mbEditorMode;
                 orxBOOL         mbDifferentialMode;
+                orxBOOL         mbCompiledMap;
                 orxBOOL         mbObjectListLocked;
+                orxBOOL         mbUpdateListLocked;
+                orxBOOL         mbUpdateListDirty;
+                orxBOOL         mbParallelUpdate;
+                orxBOOL         mbEventsFiltered;
+                orxBOOL         mbJournalValid;
+                orxBOOL         mbSavingJournal;
+                volatile orxBOOL mbStopWorkers;
                 orxBOOL         mbIsRunning;
                 orxBOOL         mbIsPaused;
 };
@@ -478,6 +873,49 @@ O *ScrollBase::GetPreviousObject(const O *_poObject) const
   return poResult;
 }
 
+template<class O>
+orxU32 ScrollBase::GetObjectCount() const
+{
+  const ScrollObjectBinder<O> *poBinder;
+  orxU32                       u32Result;
+
+  // Gets binder
+  poBinder = ScrollObjectBinder<O>::GetInstance();
+
+  // Updates result
+  u32Result = poBinder ? poBinder->GetObjectCount() : 0;
+
+  // Done!
+  return u32Result;
+}
+
+template<class O>
+O *ScrollBase::GetObjectAt(orxU32 _u32Index) const
+{
+  const ScrollObjectBinder<O> *poBinder;
+  O                           *poResult = orxNULL;
+
+  // Gets binder
+  poBinder = ScrollObjectBinder<O>::GetInstance();
+
+  // Valid?
+  if(poBinder)
+  {
+    // Updates result
+    poResult = ScrollCast<O *>(poBinder->GetObjectAt(_u32Index));
+  }
+#ifdef __SCROLL_DEBUG__
+  else
+  {
+    // Logs message
+    orxLOG("Couldn't get object #%u of <%s>: no registered binder found!", _u32Index, typeid(O).name());
+  }
+#endif // __SCROLL_DEBUG__
+
+  // Done!
+  return poResult;
+}
+
 
 #ifdef __SCROLL_IMPL__
 
@@ -517,6 +955,25 @@ const orxSTRING ScrollBase::szConfigScrollObjectAlpha         = "Alpha";
 const orxSTRING ScrollBase::szConfigScrollObjectSmoothing     = "Smoothing";
 const orxSTRING ScrollBase::szConfigScrollObjectTiling        = "Tiling";
 const orxSTRING ScrollBase::szConfigScrollObjectPausable      = "Pausable";
+const orxSTRING ScrollBase::szConfigScrollObjectParallelUpdate= "ParallelUpdate";
+const orxSTRING ScrollBase::szConfigScrollObjectPool          = "Pool";
+const orxSTRING ScrollBase::szConfigScrollObjectLifeTime      = "LifeTime";
+const orxSTRING ScrollBase::szConfigSectionScroll             = "Scroll";
+const orxSTRING ScrollBase::szConfigThreadNumber              = "ThreadNumber";
+const orxSTRING ScrollBase::szConfigCellSize                  = "CellSize";
+const orxSTRING ScrollBase::szConfigStreamMargin              = "StreamMargin";
+const orxSTRING ScrollBase::szConfigStreamBudget              = "StreamBudget";
+const orxSTRING ScrollBase::szConfigSpatialCellSize           = "SpatialCellSize";
+const orxSTRING ScrollBase::szConfigJournalSize               = "JournalSize";
+const orxSTRING ScrollBase::szMapJournalSuffix                = ".journal";
+const orxSTRING ScrollBase::szCommandCompileMap               = "Scroll.CompileMap";
+
+const orxU32    ScrollBase::su32UpdateListSize                = 256;
+const orxU32    ScrollBase::su32ParallelChunkSize             = 64;
+const orxU32    ScrollBase::su32CompiledMapMagic              = 0x324D4353; /* 'SCM2' */
+const orxU32    ScrollBase::su32StreamBudget                  = 64;
+const orxFLOAT  ScrollBase::sfSpatialCellSize                 = orx2F(128.0f);
+const orxFLOAT  ScrollBase::sfSpatialCellLimit                = orx2F(536870912.0f); /* 2^29 */
 
 
 //! Static variables
@@ -535,11 +992,23 @@ ScrollBase &ScrollBase::GetInstance()
   return *spoInstance;
 }
 
-ScrollBase::ScrollBase() : mzMapName(orxNULL), mzCurrentCreateObject(orxNULL), mzCurrentDeleteObject(orxNULL),
+ScrollBase::ScrollBase() : mapoUpdateList(orxNULL), mastParallelList(orxNULL), mapstPoolList(orxNULL), mpstPoolTable(orxNULL), mpstWorkSemaphore(orxNULL), mpstDoneSemaphore(orxNULL), mu32ParallelCursor(0),
+                           mzMapName(orxNULL), mzCurrentCreateObject(orxNULL), mzCurrentDeleteObject(orxNULL),
                            mpstMainViewport(orxNULL), mpstMainCamera(orxNULL), mpfnCustomMapSaveFilter(orxNULL),
-                           mu32NextObjectID(0), mu32RuntimeObjectID(0), mu32LayerNumber(1), mu32FrameCount(0),
-                           mbEditorMode(orxFALSE), mbDifferentialMode(orxFALSE), mbObjectListLocked(orxFALSE), mbIsRunning(orxFALSE), mbIsPaused(orxFALSE)
+                           mpu8StreamData(orxNULL), mastStreamObjectList(orxNULL), macStreamStringList(orxNULL), mpstStreamCellBank(orxNULL), mapstStreamActiveList(orxNULL), mpstStreamCellTable(orxNULL),
+                           mastSpatialList(orxNULL), mpstSpatialCellTable(orxNULL), mpstSpatialObjectTable(orxNULL), mafSpatialDistanceList(orxNULL), mpstJournalTable(orxNULL), mfSpatialCellSize(orxFLOAT_0),
+                           mfStreamCellSize(orxFLOAT_0), mfStreamMargin(orxFLOAT_0), ms32StreamMinX(0), ms32StreamMinY(0), ms32StreamMaxX(0), ms32StreamMaxY(0), mu32StreamActiveSize(0), mu32StreamActiveCount(0), mu32StreamBudget(0), mu32StreamStamp(0),
+                           mu32SpatialCount(0), mu32SpatialSize(0), mu32SpatialDistanceSize(0), mu32SpatialStamp(0),
+                           mu32JournalSize(0), mu32JournalBaseCount(0), mu32JournalBaseID(0), mu32JournalNewCount(0),
+                           mu32NextObjectID(0), mu32RuntimeObjectID(0), mu32LayerNumber(1), mu32FrameCount(0), mu32SkippedEventCount(0), mu32UpdateCount(0), mu32UpdateSize(0),
+                           mu32PoolCount(0), mu32PoolSize(0), mu32ParallelCount(0), mu32ParallelSize(0), mu32WorkerCount(0),
+                           mbEditorMode(orxFALSE), mbDifferentialMode(orxFALSE), mbCompiledMap(orxFALSE), mbObjectListLocked(orxFALSE), mbUpdateListLocked(orxFALSE), mbUpdateListDirty(orxFALSE),
+                           mbParallelUpdate(orxFALSE), mbEventsFiltered(orxFALSE), mbJournalValid(orxFALSE), mbSavingJournal(orxFALSE), mbStopWorkers(orxFALSE), mbIsRunning(orxFALSE), mbIsPaused(orxFALSE)
 {
+  // Clears deferred command & spatial lists
+  orxMemory_Zero(mastDeferredList, sizeof(mastDeferredList));
+  orxMemory_Zero(&mstSpatialPendingList, sizeof(SpatialList));
+  orxMemory_Zero(&mstSpatialDynamicList, sizeof(SpatialList));
 }
 
 ScrollBase::~ScrollBase()
@@ -565,8 +1034,8 @@ ScrollObject *ScrollBase::CreateObject(const orxSTRING _zModelName, ScrollObject
   // Checks
   orxASSERT((_xFlags & ScrollObject::MaskAll) == _xFlags);
 
-  // Valid?
-  if(_zModelName && (_zModelName != orxSTRING_EMPTY))
+  // Valid and no pooled instance available?
+  if(_zModelName && (_zModelName != orxSTRING_EMPTY) && ((poResult = ReusePooledObject(_zModelName, _xFlags, _zInstanceName)) == orxNULL))
   {
     orxCHAR                 zInstanceName[32];
     const orxSTRING         zPreviousObject;
@@ -582,7 +1051,7 @@ ScrollObject *ScrollBase::CreateObject(const orxSTRING _zModelName, ScrollObject
     mzCurrentCreateObject = _zModelName;
 
     // Uses it
-    poResult = poBinder->CreateObject(_zModelName, _zInstanceName ? _zInstanceName : GetNewObjectName(zInstanceName, (_xFlags & ScrollObject::FlagRunTime) ? orxTRUE : orxFALSE), _xFlags);
+    poResult = poBinder->CreateObject(_zModelName, (_zInstanceName || (_xFlags & ScrollObject::FlagRunTime)) ? _zInstanceName : GetNewObjectName(zInstanceName), _xFlags);
 
     // Restores previous object
     mzCurrentCreateObject = zPreviousObject;
@@ -590,6 +1059,13 @@ ScrollObject *ScrollBase::CreateObject(const orxSTRING _zModelName, ScrollObject
     // Valid?
     if(poResult)
     {
+      // Savable?
+      if(poResult->TestFlags(ScrollObject::FlagSave))
+      {
+        // Marks it as modified
+        poResult->SetFlags(ScrollObject::FlagDirty);
+      }
+
       // Savable or runtime object?
       if(poResult->TestFlags(ScrollObject::FlagSave | ScrollObject::FlagRunTime))
       {
@@ -641,14 +1117,14 @@ ScrollObject *ScrollBase::CreateObject(orxOBJECT *_pstOrxObject, ScrollObject::F
     // Gets binder
     poBinder = ScrollObjectBinderBase::GetBinder(zObjectName);
 
-    // Uses it
-    poResult = poBinder->CreateObject(_pstOrxObject, _zInstanceName ? _zInstanceName : GetNewObjectName(zInstanceName, (_xFlags & ScrollObject::FlagRunTime) ? orxTRUE : orxFALSE), _xFlags);
+    // Uses it (runtime objects get named on demand)
+    poResult = poBinder->CreateObject(_pstOrxObject, (_zInstanceName || (_xFlags & ScrollObject::FlagRunTime)) ? _zInstanceName : GetNewObjectName(zInstanceName), _xFlags);
 
     // Valid?
     if(poResult)
     {
       // Updates it
-      poResult->SetFlags(_xFlags, ScrollObject::MaskAll);
+      poResult->SetFlags((_xFlags & ScrollObject::FlagSave) ? _xFlags | ScrollObject::FlagDirty : _xFlags, ScrollObject::MaskAll);
 
       // Savable or runtime object?
       if(poResult->TestFlags(ScrollObject::FlagSave | ScrollObject::FlagRunTime))
@@ -680,8 +1156,8 @@ ScrollObject *ScrollBase::CreateObject(orxOBJECT *_pstOrxObject, ScrollObject::F
 
 void ScrollBase::DeleteObject(ScrollObject *_poObject)
 {
-  // Valid?
-  if(_poObject)
+  // Valid and not recycled for later reuse?
+  if(_poObject && (!_poObject->TestFlags(ScrollObject::FlagPooled) || (RecycleObject(_poObject) == orxSTATUS_FAILURE)))
   {
     // Object list not locked?
     if(!mbObjectListLocked)
@@ -792,6 +1268,189 @@ ScrollObject *ScrollBase::PickObject(const orxOBOX &_rstBox, orxSTRINGID _stGrou
   return poResult;
 }
 
+orxU32 ScrollBase::PickObjects(const orxVECTOR *_avPositionList, orxU32 _u32Number, ScrollObject **_apoResultList, orxSTRINGID _stGroupID) const
+{
+  orxU32 u32Result = 0;
+
+  // Checks
+  orxASSERT((_u32Number == 0) || (_avPositionList && _apoResultList));
+
+  // For all positions
+  for(orxU32 i = 0; i < _u32Number; i++)
+  {
+    // Picks object
+    _apoResultList[i] = PickObject(_avPositionList[i], _stGroupID);
+
+    // Found?
+    if(_apoResultList[i])
+    {
+      // Updates result
+      u32Result++;
+    }
+  }
+
+  // Done!
+  return u32Result;
+}
+
+orxU32 ScrollBase::FindObjects(const orxAABOX &_rstBox, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID)
+{
+  orxVECTOR vMin, vMax;
+  orxU32    u32Result;
+
+  // Gets box corners
+  orxVector_Min(&vMin, &_rstBox.vTL, &_rstBox.vBR);
+  orxVector_Max(&vMax, &_rstBox.vTL, &_rstBox.vBR);
+
+  // Finds objects
+  u32Result = FindSpatialObjects(vMin, vMax, orxNULL, orxFLOAT_0, _apstResultList, _u32ResultSize, _stGroupID);
+
+  // Done!
+  return u32Result;
+}
+
+orxU32 ScrollBase::FindObjects(const orxVECTOR &_rvCenter, orxFLOAT _fRadius, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID)
+{
+  orxVECTOR vMin, vMax;
+  orxU32    u32Result;
+
+  // Gets bounding square
+  orxVector_Set(&vMin, _rvCenter.fX - _fRadius, _rvCenter.fY - _fRadius, _rvCenter.fZ);
+  orxVector_Set(&vMax, _rvCenter.fX + _fRadius, _rvCenter.fY + _fRadius, _rvCenter.fZ);
+
+  // Finds objects
+  u32Result = FindSpatialObjects(vMin, vMax, &_rvCenter, _fRadius * _fRadius, _apstResultList, _u32ResultSize, _stGroupID);
+
+  // Done!
+  return u32Result;
+}
+
+orxU32 ScrollBase::FindNearestObjects(const orxVECTOR &_rvPosition, orxOBJECT **_apstResultList, orxU32 _u32Number, orxSTRINGID _stGroupID, orxFLOAT _fMaxDistance)
+{
+  orxFLOAT  fMaxSquareDistance;
+  orxS32    s32X, s32Y;
+  orxU32    u32Visited = 0, u32Result = 0;
+
+  // Checks
+  orxASSERT((_u32Number == 0) || _apstResultList);
+
+  // Enables & refreshes spatial hash
+  EnableSpatialHash();
+  RefreshSpatialHash();
+
+  // Distance list too small?
+  if(_u32Number > mu32SpatialDistanceSize)
+  {
+    // Grows it
+    mu32SpatialDistanceSize = _u32Number;
+    mafSpatialDistanceList  = (orxFLOAT *)orxMemory_Reallocate(mafSpatialDistanceList, mu32SpatialDistanceSize * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+    orxASSERT(mafSpatialDistanceList);
+  }
+
+  // Gets search limits
+  fMaxSquareDistance  = (_fMaxDistance < orxFLOAT_MAX) ? _fMaxDistance * _fMaxDistance : orxFLOAT_MAX;
+  s32X                = GetSpatialCell(_rvPosition.fX);
+  s32Y                = GetSpatialCell(_rvPosition.fY);
+
+  // For all rings of cells around the position, while some objects haven't been visited
+  for(orxS32 s32Ring = 0; (_u32Number != 0) && (u32Visited < mu32SpatialCount); s32Ring++)
+  {
+    orxFLOAT fRingDistance;
+    orxS32   s32Span;
+    orxBOOL  bScanAll;
+
+    // Gets ring's minimal distance
+    fRingDistance = orxS2F(orxMAX(s32Ring - 1, 0)) * mfSpatialCellSize;
+
+    // Can't contain any closer object?
+    if(fRingDistance * fRingDistance > ((u32Result == _u32Number) ? mafSpatialDistanceList[u32Result - 1] : fMaxSquareDistance))
+    {
+      // Stops
+      break;
+    }
+
+    // Rings covering more cells than entries (small group, far objects)? Scans them all instead, from scratch
+    bScanAll = ((orxU32)(2 * s32Ring + 1) * (orxU32)(2 * s32Ring + 1) > mu32SpatialCount) ? orxTRUE : orxFALSE;
+    if(bScanAll)
+    {
+      u32Visited = u32Result = 0;
+    }
+    s32Span = bScanAll ? 0 : s32Ring;
+
+    // For all cells on the ring
+    for(orxS32 j = -s32Span; j <= s32Span; j++)
+    {
+      for(orxS32 i = -s32Span; i <= s32Span; i += ((j == -s32Span) || (j == s32Span)) ? 1 : 2 * s32Span)
+      {
+        orxU32 u32Index;
+
+        // For all its entries
+        for(u32Index = bScanAll ? orxMIN(mu32SpatialCount, 1u) : (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialCellTable, GetCellKey(s32X + i, s32Y + j));
+            u32Index != 0;
+            u32Index = bScanAll ? ((u32Index < mu32SpatialCount) ? u32Index + 1 : 0) : mastSpatialList[u32Index - 1].u32Next + 1)
+        {
+          const SpatialEntry *pstEntry;
+
+          // Gets it
+          pstEntry = &mastSpatialList[u32Index - 1];
+
+          // Updates visit count
+          u32Visited++;
+
+          // Enabled and in group?
+          if(orxObject_IsEnabled(pstEntry->pstObject)
+          && ((_stGroupID == orxSTRINGID_UNDEFINED) || (orxObject_GetGroupID(pstEntry->pstObject) == _stGroupID)))
+          {
+            orxVECTOR vPosition;
+            orxFLOAT  fSquareDistance;
+
+            // Gets its distance
+            GetSpatialPosition(*pstEntry, vPosition);
+            fSquareDistance = (vPosition.fX - _rvPosition.fX) * (vPosition.fX - _rvPosition.fX)
+                            + (vPosition.fY - _rvPosition.fY) * (vPosition.fY - _rvPosition.fY);
+
+            // Close enough and closer than the current farthest one?
+            if((fSquareDistance <= fMaxSquareDistance)
+            && ((u32Result < _u32Number) || (fSquareDistance < mafSpatialDistanceList[u32Result - 1])))
+            {
+              orxU32 u32Slot;
+
+              // Shifts farther objects
+              for(u32Slot = orxMIN(u32Result, _u32Number - 1);
+                  (u32Slot > 0) && (mafSpatialDistanceList[u32Slot - 1] > fSquareDistance);
+                  u32Slot--)
+              {
+                mafSpatialDistanceList[u32Slot]  = mafSpatialDistanceList[u32Slot - 1];
+                _apstResultList[u32Slot]          = _apstResultList[u32Slot - 1];
+              }
+
+              // Inserts it
+              mafSpatialDistanceList[u32Slot]  = fSquareDistance;
+              _apstResultList[u32Slot]          = pstEntry->pstObject;
+
+              // Updates result
+              if(u32Result < _u32Number)
+              {
+                u32Result++;
+              }
+            }
+          }
+        }
+
+        // Center cell or all entries?
+        if(s32Span == 0)
+        {
+          // Stops
+          break;
+        }
+      }
+    }
+  }
+
+  // Done!
+  return u32Result;
+}
+
 orxCOLOR *ScrollBase::GetObjectConfigColor(const ScrollObject *_poObject, orxCOLOR &_rstColor)
 {
   orxCOLOR *pstResult = orxNULL;
@@ -877,6 +1536,8 @@ orxSTATUS ScrollBase::SetMapName(const orxSTRING _zMapName)
     mzMapName = orxString_Duplicate(_zMapName);
   }
 
+  mbCompiledMap = orxFALSE;
+
   return orxSTATUS_SUCCESS;
 }
 
@@ -922,16 +1583,21 @@ const orxSTRING ScrollBase::GetMapShortName() const
 
 orxSTATUS ScrollBase::LoadMap()
 {
-  orxCHAR   acBuffer[32];
+  orxCHAR   acBuffer[32], acJournalName[256];
   orxU32    i;
   orxSTATUS eResult;
 
   // Object list not locked and has a valid map name?
   if(!mbObjectListLocked && mzMapName && (mzMapName != orxSTRING_EMPTY))
   {
+    orxBOOL bJournal = orxFALSE;
+
     // Updates result
     eResult = orxSTATUS_SUCCESS;
 
+    // Invalidates journal
+    ResetJournal(0, orxFALSE);
+
     // For all current objects
     for(ScrollObject *poObject = GetNextObject(), *poNextObject = GetNextObject(poObject);
         poObject;
@@ -945,11 +1611,26 @@ orxSTATUS ScrollBase::LoadMap()
       }
     }
 
-    // Loads map
-    if(orxConfig_Load(mzMapName))
+    // Stops streaming
+    StopStreaming();
+    mfStreamCellSize = orxFLOAT_0;
+
+    // Loads map, unless it's a compiled one
+    if(((mbCompiledMap = (LoadCompiledMap() != orxSTATUS_FAILURE)) == orxFALSE)
+    && (orxConfig_Load(mzMapName)))
     {
       orxS32 s32ScrollObjectCount, s32ScrollObjectNumber;
 
+      // Has journal?
+      if(orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, GetJournalName(acJournalName, sizeof(acJournalName))))
+      {
+        // Applies it on top of the map
+        bJournal = (orxConfig_Load(acJournalName) != orxSTATUS_FAILURE);
+      }
+
+      // Map may have changed section parents: invalidates resolved binders
+      ClearBinderCache();
+
       // Selects map section
       orxConfig_SelectSection(szConfigSectionMap);
 
@@ -973,11 +1654,14 @@ orxSTATUS ScrollBase::LoadMap()
           // Selects its section
           orxConfig_SelectSection(acBuffer);
 
+          // Deleted in journal?
+          if(orxConfig_GetBool(szConfigNoSave))
+          {
+            // Clears its section
+            orxConfig_ClearSection(acBuffer);
+          }
           // Creates it
-          poObject = CreateObject(orxConfig_GetString(szConfigScrollObjectName), ScrollObject::FlagSave, acBuffer);
-
-          // Valid?
-          if(poObject)
+          else if((poObject = CreateObject(orxConfig_GetString(szConfigScrollObjectName), ScrollObject::FlagSave, acBuffer)) != orxNULL)
           {
             orxVECTOR   vPos, vScale;
             orxCOLOR    stColor;
@@ -1051,6 +1735,9 @@ orxSTATUS ScrollBase::LoadMap()
               // Resets its tiling
               orxObject_SetRepeat(pstOrxObject, orxFLOAT_1, orxFLOAT_1);
             }
+
+            // Matches the map content
+            poObject->SetFlags(ScrollObject::FlagNone, ScrollObject::FlagDirty);
           }
           else
           {
@@ -1095,6 +1782,9 @@ orxSTATUS ScrollBase::LoadMap()
         // Updates camera zoom
         orxCamera_SetZoom(mpstMainCamera, orxConfig_GetFloat(szConfigCameraZoom));
       }
+
+      // Starts a new journal, unless one was just applied (the next save will compact it)
+      ResetJournal((orxU32)s32ScrollObjectNumber, !bJournal);
     }
 
     // Calls map load callback
@@ -1116,81 +1806,184 @@ orxSTATUS ScrollBase::SaveMap(orxBOOL _bEncrypt, const orxCONFIG_SAVE_FUNCTION _
   orxU32        u32Count;
   orxSTATUS     eResult = orxSTATUS_FAILURE;
 
-  // Valid?
-  if(mzMapName && (mzMapName != orxSTRING_EMPTY))
+  // Compiled map?
+  if(mbCompiledMap)
   {
-    orxVECTOR vPos;
-
-    // Stores camera position
-    orxConfig_SetVector(szConfigCameraPosition, orxCamera_GetPosition(mpstMainCamera, &vPos));
-
-    // Stores camera zoom
-    orxConfig_SetFloat(szConfigCameraZoom, orxCamera_GetZoom(mpstMainCamera));
-
-    // Stores differential mode
-    orxConfig_SetBool(szConfigDifferential, mbDifferentialMode);
+    CompiledMap stMap;
 
-    // Stores layer number
-    orxConfig_SetU32(szConfigLayerNumber, mu32LayerNumber);
+    // Inits it
+    orxMemory_Zero(&stMap, sizeof(CompiledMap));
+    stMap.stHeader.u32Flags       = CompiledMapFlagLayerNumber | CompiledMapFlagCameraPosition | CompiledMapFlagCameraZoom | (mbDifferentialMode ? CompiledMapFlagDifferential : 0);
+    stMap.stHeader.u32LayerNumber = mu32LayerNumber;
+    stMap.stHeader.fCellSize      = mfStreamCellSize;
+    stMap.stHeader.fCameraZoom    = orxCamera_GetZoom(mpstMainCamera);
+    orxCamera_GetPosition(mpstMainCamera, &stMap.stHeader.vCameraPosition);
 
     // Locks object list
     mbObjectListLocked = orxTRUE;
 
-    // For all objects
-    for(poObject = GetNextObject(), u32Count = 0;
+    // For all savable objects
+    for(poObject = GetNextObject();
         poObject;
         poObject = GetNextObject(poObject))
     {
-      // Selects its section
-      orxConfig_SelectSection(poObject->GetName());
-
       // Should save it?
       if(poObject->TestFlags(ScrollObject::FlagSave))
       {
-        orxCOLOR    stColor;
-        orxVECTOR   vTemp;
-        orxOBJECT  *pstOrxObject;
+        CompiledMapObject  *pstEntry;
+        orxOBJECT          *pstOrxObject;
+        orxU32              u32ID;
+
+        // Gets its ID from its name
+        if(orxString_ToU32(poObject->GetName() + orxString_GetLength(szConfigScrollObjectPrefix), &u32ID, orxNULL) == orxSTATUS_FAILURE)
+        {
+          // Uses a new one
+          u32ID = mu32NextObjectID++;
+        }
 
         // Gets internal object
         pstOrxObject = poObject->GetOrxObject();
 
-        // Adds all its properties
-        orxConfig_SetString(szConfigScrollObjectName, poObject->GetModelName());
-        if(orxObject_GetPosition(pstOrxObject, &vTemp))
+        // Adds its entry
+        pstEntry = AddCompiledMapObject(stMap, poObject->GetModelName(), u32ID);
+        orxObject_GetPosition(pstOrxObject, &pstEntry->vPosition);
+        orxObject_GetScale(pstOrxObject, &pstEntry->vScale);
+        pstEntry->fRotation = orxObject_GetRotation(pstOrxObject);
+        if(GetObjectConfigColor(poObject, pstEntry->stColor))
         {
-          orxConfig_SetVector(szConfigScrollObjectPosition, &vTemp);
+          pstEntry->u32Flags |= CompiledObjectFlagColor;
         }
-        if(orxObject_GetScale(pstOrxObject, &vTemp))
+        if(poObject->TestFlags(ScrollObject::FlagSmoothed))
         {
-          orxConfig_SetVector(szConfigScrollObjectScale, &vTemp);
+          pstEntry->u32Flags |= CompiledObjectFlagSmoothing;
         }
-        orxConfig_SetFloat(szConfigScrollObjectRotation, orxObject_GetRotation(pstOrxObject));
-        if(GetObjectConfigColor(poObject, stColor))
+        if(poObject->TestFlags(ScrollObject::FlagTiled))
         {
-          orxConfig_SetVector(szConfigScrollObjectColor, &stColor.vRGB);
-          orxConfig_SetFloat(szConfigScrollObjectAlpha, stColor.fAlpha);
+          pstEntry->u32Flags |= CompiledObjectFlagTiling;
         }
-        orxConfig_SetBool(szConfigScrollObjectSmoothing, poObject->TestFlags(ScrollObject::FlagSmoothed));
-        orxConfig_SetBool(szConfigScrollObjectTiling, poObject->TestFlags(ScrollObject::FlagTiled));
-
-        // Updates count
-        u32Count++;
       }
-      else
-      {
-        // Don't save
+    }
+
+    // Unlocks object list
+    mbObjectListLocked = orxFALSE;
+
+    // For all streamed cells
+    for(const StreamCell *pstCell = mpstStreamCellBank ? (const StreamCell *)orxBank_GetNext(mpstStreamCellBank, orxNULL) : orxNULL;
+        pstCell;
+        pstCell = (const StreamCell *)orxBank_GetNext(mpstStreamCellBank, pstCell))
+    {
+      // For all its objects that aren't currently loaded
+      for(orxU32 j = pstCell->u32Loaded; j < pstCell->u32Count; j++)
+      {
+        const CompiledMapObject *pstEntry;
+
+        // Gets its entry
+        pstEntry = &mastStreamObjectList[pstCell->au32EntryList[j]];
+
+        // Not deleted?
+        if(!orxFLAG_TEST(pstEntry->u32Flags, CompiledObjectFlagDeleted))
+        {
+          CompiledMapObject *pstNewEntry;
+
+          // Copies it
+          pstNewEntry = AddCompiledMapObject(stMap, macStreamStringList + pstEntry->u32ModelOffset, pstEntry->u32ID);
+          orxMemory_Copy(&pstNewEntry->u32Flags, &pstEntry->u32Flags, sizeof(CompiledMapObject) - offsetof(CompiledMapObject, u32Flags));
+        }
+      }
+    }
+
+    // Calls save callback
+    OnMapSave(_bEncrypt);
+
+    // Writes it
+    eResult = WriteCompiledMap(stMap, mzMapName);
+  }
+  // Valid?
+  else if(mzMapName && (mzMapName != orxSTRING_EMPTY))
+  {
+    orxCHAR   acJournalName[256];
+    orxVECTOR vPos;
+    orxBOOL   bJournal;
+
+    // Only saves modified objects to the journal, if any
+    bJournal = mbJournalValid;
+
+    // Stores camera position
+    orxConfig_SetVector(szConfigCameraPosition, orxCamera_GetPosition(mpstMainCamera, &vPos));
+
+    // Stores camera zoom
+    orxConfig_SetFloat(szConfigCameraZoom, orxCamera_GetZoom(mpstMainCamera));
+
+    // Stores differential mode
+    orxConfig_SetBool(szConfigDifferential, mbDifferentialMode);
+
+    // Stores layer number
+    orxConfig_SetU32(szConfigLayerNumber, mu32LayerNumber);
+
+    // Locks object list
+    mbObjectListLocked = orxTRUE;
+
+    // For all objects
+    for(poObject = GetNextObject(), u32Count = 0;
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Should save it?
+      if(poObject->TestFlags(ScrollObject::FlagSave))
+      {
+        // Not journaling or modified?
+        if(!bJournal || poObject->TestFlags(ScrollObject::FlagDirty))
+        {
+          // Stores it
+          StoreMapObject(poObject);
+
+          // Journaling?
+          if(bJournal)
+          {
+            // Adds it to the journal
+            AddJournalSection(poObject->GetName());
+          }
+        }
+
+        // Updates count
+        u32Count++;
+      }
+      else
+      {
+        // Don't save
+        orxConfig_SelectSection(poObject->GetName());
         orxConfig_SetBool(szConfigNoSave, orxTRUE);
       }
     }
 
+    // Journal has grown too large?
+    if(bJournal && (orxHashTable_GetCount(mpstJournalTable) > mu32JournalSize))
+    {
+      // For all savable objects
+      for(poObject = GetNextObject();
+          poObject;
+          poObject = GetNextObject(poObject))
+      {
+        // Not stored yet?
+        if(poObject->TestFlags(ScrollObject::FlagSave) && !orxHashTable_Get(mpstJournalTable, orxString_Hash(poObject->GetName())))
+        {
+          // Stores it
+          StoreMapObject(poObject);
+        }
+      }
+
+      // Compacts it into a full save
+      bJournal = orxFALSE;
+    }
+
     // Unlocks object list
     mbObjectListLocked = orxFALSE;
 
     // Restores map section
     orxConfig_SelectSection(szConfigSectionMap);
 
-    // Stores game object count
-    orxConfig_SetS32(szConfigScrollObjectNumber, u32Count);
+    // Stores game object count (journaled sections are still counted when loading)
+    orxConfig_SetS32(szConfigScrollObjectNumber, bJournal ? mu32JournalBaseCount + mu32JournalNewCount : u32Count);
 
     // Calls save callback
     OnMapSave(_bEncrypt);
@@ -1198,8 +1991,29 @@ orxSTATUS ScrollBase::SaveMap(orxBOOL _bEncrypt, const orxCONFIG_SAVE_FUNCTION _
     // Stores custom save filter
     mpfnCustomMapSaveFilter = _pfnMapSaveFilter;
 
+    // Gets journal name
+    GetJournalName(acJournalName, sizeof(acJournalName));
+
+    // Journaling?
+    if(bJournal)
+    {
+      // Saves journal to file
+      mbSavingJournal = orxTRUE;
+      eResult         = orxConfig_Save(acJournalName, _bEncrypt, StaticMapSaveFilter);
+      mbSavingJournal = orxFALSE;
+    }
     // Saves to file
-    eResult = orxConfig_Save(mzMapName, _bEncrypt, StaticMapSaveFilter);
+    else if((eResult = orxConfig_Save(mzMapName, _bEncrypt, StaticMapSaveFilter)) != orxSTATUS_FAILURE)
+    {
+      // Starts a new journal
+      ResetJournal(u32Count, orxTRUE);
+
+      // Removes outdated one
+      if(orxFile_Exists(acJournalName))
+      {
+        orxFile_Remove(acJournalName);
+      }
+    }
 
     // Clears custom save filter
     mpfnCustomMapSaveFilter = orxNULL;
@@ -1209,695 +2023,3073 @@ orxSTATUS ScrollBase::SaveMap(orxBOOL _bEncrypt, const orxCONFIG_SAVE_FUNCTION _
   return eResult;
 }
 
-orxSTATUS ScrollBase::ResetMap()
+void ScrollBase::StoreMapObject(ScrollObject *_poObject)
 {
-  orxVECTOR vPos;
-  orxFLOAT  fZoom;
-  orxSTATUS eResult;
-
-  // Backups camera position & zoom
-  orxCamera_GetPosition(mpstMainCamera, &vPos);
-  fZoom = orxCamera_GetZoom(mpstMainCamera);
-
-  // Reloads it
-  eResult = LoadMap();
-
-  // Restores main camera position & zoom
-  orxCamera_SetPosition(mpstMainCamera, &vPos);
-  orxCamera_SetZoom(mpstMainCamera, fZoom);
+  orxCOLOR    stColor;
+  orxVECTOR   vTemp;
+  orxOBJECT  *pstOrxObject;
 
-  // Done!
-  return eResult;
-}
+  // Selects its section
+  orxConfig_SelectSection(_poObject->GetName());
 
-void ScrollBase::SetLayerNumber(orxU32 _u32LayerNumber)
-{
-  orxAABOX    stFrustum;
-  orxVECTOR   vPos;
-  orxFLOAT    fDepth, fWidth, fHeight;
-  orxCAMERA  *pstCamera;
+  // Gets internal object
+  pstOrxObject = _poObject->GetOrxObject();
 
-  // Is even?
-  if(!(_u32LayerNumber & 1))
+  // Adds all its properties
+  orxConfig_SetString(szConfigScrollObjectName, _poObject->GetModelName());
+  if(orxObject_GetPosition(pstOrxObject, &vTemp))
   {
-    // Adds an extra layer
-    mu32LayerNumber = _u32LayerNumber + 1;
-
-    // Logs message
-    orxLOG("Can't use an even number of layers, adding an extra one => %d layers will be used.", mu32LayerNumber);
+    orxConfig_SetVector(szConfigScrollObjectPosition, &vTemp);
   }
-  else
+  if(orxObject_GetScale(pstOrxObject, &vTemp))
   {
-    // Stores it
-    mu32LayerNumber = _u32LayerNumber;
+    orxConfig_SetVector(szConfigScrollObjectScale, &vTemp);
+  }
+  orxConfig_SetFloat(szConfigScrollObjectRotation, orxObject_GetRotation(pstOrxObject));
+  if(GetObjectConfigColor(_poObject, stColor))
+  {
+    orxConfig_SetVector(szConfigScrollObjectColor, &stColor.vRGB);
+    orxConfig_SetFloat(szConfigScrollObjectAlpha, stColor.fAlpha);
   }
+  orxConfig_SetBool(szConfigScrollObjectSmoothing, _poObject->TestFlags(ScrollObject::FlagSmoothed));
+  orxConfig_SetBool(szConfigScrollObjectTiling, _poObject->TestFlags(ScrollObject::FlagTiled));
 
-  // Gets main camera
-  pstCamera = GetMainCamera();
+  // Clears its modified status
+  _poObject->SetFlags(ScrollObject::FlagNone, ScrollObject::FlagDirty);
+}
 
-  // Gets its frustum & position
-  orxCamera_GetFrustum(pstCamera, &stFrustum);
-  orxCamera_GetPosition(pstCamera, &vPos);
+void ScrollBase::ResetJournal(orxU32 _u32BaseCount, orxBOOL _bValid)
+{
+  // Has journal?
+  if(mpstJournalTable)
+  {
+    const orxSTRING zSection;
 
-  // Gets its size & depth
-  fWidth  = stFrustum.vBR.fX - stFrustum.vTL.fX;
-  fHeight = stFrustum.vBR.fY - stFrustum.vTL.fY;
-  fDepth  = stFrustum.vBR.fZ - stFrustum.vTL.fZ;
+    // For all its sections
+    for(orxHANDLE hIterator = orxHashTable_GetNext(mpstJournalTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&zSection);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(mpstJournalTable, hIterator, orxNULL, (void **)&zSection))
+    {
+      // Is a tombstone?
+      if(orxConfig_HasSection(zSection) && (orxConfig_PushSection(zSection) != orxSTATUS_FAILURE))
+      {
+        orxBOOL bTombstone;
 
-  // Calculates correct position for the camera
-  vPos.fZ = -orx2F(0.5f) * fDepth;
+        // Gets its status
+        bTombstone = orxConfig_GetBool(szConfigNoSave);
 
-  // Updates camera position
-  orxCamera_SetPosition(pstCamera, &vPos);
+        // Pops section
+        orxConfig_PopSection();
 
-  // Updates camera frustum
-  orxCamera_SetFrustum(pstCamera, fWidth, fHeight, orxFLOAT_0, fDepth);
-}
+        // Tombstone?
+        if(bTombstone)
+        {
+          // Clears it
+          orxConfig_ClearSection(zSection);
+        }
+      }
+    }
 
-orxU32 ScrollBase::GetLayerNumber() const
-{
-  // Done!
-  return mu32LayerNumber;
-}
+    // Clears it
+    orxHashTable_Clear(mpstJournalTable);
+  }
 
-orxU32 ScrollBase::GetLayer(const orxVECTOR &_rvPosition) const
-{
-  orxAABOX  stFrustum;
-  orxVECTOR vCameraPos;
-  orxU32    u32Result;
+  // Gets journal size
+  orxConfig_PushSection(szConfigSectionScroll);
+  mu32JournalSize = orxConfig_GetU32(szConfigJournalSize);
+  orxConfig_PopSection();
 
-  // Gets asbolute frustum
-  orxCamera_GetFrustum(GetMainCamera(), &stFrustum);
-  orxCamera_GetPosition(GetMainCamera(), &vCameraPos);
-  orxVector_Add(&(stFrustum.vTL), &(stFrustum.vTL), &vCameraPos);
-  orxVector_Add(&(stFrustum.vBR), &(stFrustum.vBR), &vCameraPos);
+  // Enabled and no table yet?
+  if((mu32JournalSize != 0) && !mpstJournalTable)
+  {
+    // Creates it
+    mpstJournalTable = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxASSERT(mpstJournalTable);
+  }
 
-  // Updates result
-  u32Result = orxF2U((_rvPosition.fZ - stFrustum.vTL.fZ) / (stFrustum.vBR.fZ - stFrustum.vTL.fZ) * orxU2F(mu32LayerNumber));
+  // Stores base content
+  mu32JournalBaseCount  = _u32BaseCount;
+  mu32JournalBaseID     = mu32NextObjectID;
+  mu32JournalNewCount   = 0;
 
-  // Done!
-  return u32Result;
+  // Updates status
+  mbJournalValid        = (_bValid && (mu32JournalSize != 0)) ? orxTRUE : orxFALSE;
 }
 
-orxFLOAT ScrollBase::GetLayerDepth(orxU32 _u32Layer) const
+void ScrollBase::AddJournalSection(const orxSTRING _zSectionName)
 {
-  orxAABOX stFrustum;
-  orxFLOAT fResult;
+  orxSTRINGID stID;
 
-  // Corrects range
-  _u32Layer = orxMIN(_u32Layer, mu32LayerNumber);
+  // Checks
+  orxASSERT(mpstJournalTable);
 
-  // Gets camera depth
-  orxCamera_GetFrustum(GetMainCamera(), &stFrustum);
+  // Gets its ID
+  stID = orxString_Hash(_zSectionName);
 
-  // Game layer?
-  if(((mu32LayerNumber - 1) >> 1) == _u32Layer)
-  {
-    fResult = orxFLOAT_0;
-  }
-  else
+  // Not already journaled?
+  if(!orxHashTable_Get(mpstJournalTable, stID))
   {
-    orxVECTOR vCameraPos;
+    orxU32 u32ID;
 
-    // Gets camera position
-    orxCamera_GetPosition(GetMainCamera(), &vCameraPos);
+    // Adds it
+    orxHashTable_Add(mpstJournalTable, stID, (void *)orxString_Store(_zSectionName));
 
-    // Updates result
-    fResult = orxLERP(stFrustum.vTL.fZ, stFrustum.vBR.fZ, (orxU2F(_u32Layer) + orx2F(0.5f)) / orxU2F(mu32LayerNumber)) + vCameraPos.fZ;
+    // Not part of the base map?
+    if((orxString_ToU32(_zSectionName + orxString_GetLength(szConfigScrollObjectPrefix), &u32ID, orxNULL) != orxSTATUS_FAILURE)
+    && (u32ID >= mu32JournalBaseID))
+    {
+      // Updates count
+      mu32JournalNewCount++;
+    }
   }
+}
+
+const orxSTRING ScrollBase::GetJournalName(orxCHAR *_acBuffer, orxU32 _u32Size) const
+{
+  // Creates it
+  orxString_NPrint(_acBuffer, _u32Size, "%s%s", mzMapName, szMapJournalSuffix);
 
   // Done!
-  return fResult;
+  return _acBuffer;
 }
 
-orxSTATUS ScrollBase::StartGame()
+orxSTATUS ScrollBase::CompileMap(const orxSTRING _zMapName, const orxSTRING _zOutputName)
 {
-  orxSTATUS eResult;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
 
-  // Not already running?
-  if(!mbIsRunning)
+  // Loads map
+  if(orxConfig_Load(_zMapName))
   {
-    // Updates result
-    eResult = orxSTATUS_SUCCESS;
+    CompiledMap stMap;
+    orxCHAR     acBuffer[32];
+    orxS32      s32ScrollObjectCount, s32ScrollObjectNumber;
+    orxU32      i;
 
-    // Locks object list
-    mbObjectListLocked = orxTRUE;
+    // Map may have changed section parents: invalidates resolved binders
+    ClearBinderCache();
 
-    // For all objects
-    for(ScrollObject *poObject = GetNextObject();
-        poObject;
-        poObject = GetNextObject(poObject))
+    // Inits it
+    orxMemory_Zero(&stMap, sizeof(CompiledMap));
+
+    // Pushes map section
+    orxConfig_PushSection(szConfigSectionMap);
+
+    // Stores its properties
+    if(orxConfig_GetBool(szConfigDifferential))
     {
-      // Calls its callback
-      poObject->OnStartGame();
+      stMap.stHeader.u32Flags |= CompiledMapFlagDifferential;
+    }
+    if(orxConfig_HasValue(szConfigLayerNumber))
+    {
+      stMap.stHeader.u32Flags      |= CompiledMapFlagLayerNumber;
+      stMap.stHeader.u32LayerNumber = orxConfig_GetU32(szConfigLayerNumber);
+    }
+    if(orxConfig_GetVector(szConfigCameraPosition, &stMap.stHeader.vCameraPosition))
+    {
+      stMap.stHeader.u32Flags |= CompiledMapFlagCameraPosition;
+    }
+    if(orxConfig_HasValue(szConfigCameraZoom))
+    {
+      stMap.stHeader.u32Flags    |= CompiledMapFlagCameraZoom;
+      stMap.stHeader.fCameraZoom  = orxConfig_GetFloat(szConfigCameraZoom);
     }
+    stMap.stHeader.fCellSize = orxMAX(orxConfig_GetFloat(szConfigCellSize), orxFLOAT_0);
 
-    // Unlocks object list
-    mbObjectListLocked = orxFALSE;
+    // Gets number of objects
+    s32ScrollObjectNumber = orxConfig_GetS32(szConfigScrollObjectNumber);
 
-    // Updates running status
-    mbIsRunning = orxTRUE;
+    // Pops config section
+    orxConfig_PopSection();
 
-    // Calls start game callback
-    OnStartGame();
-  }
-  else
-  {
-    // Updates result
-    eResult = orxSTATUS_FAILURE;
+    // For all objects
+    for(s32ScrollObjectCount = 0, i = 0, orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, i);
+        s32ScrollObjectCount < s32ScrollObjectNumber;
+        i++, orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, i))
+    {
+      // Has section?
+      if(orxConfig_HasSection(acBuffer))
+      {
+        CompiledMapObject *pstEntry;
+
+        // Pushes its section
+        orxConfig_PushSection(acBuffer);
+
+        // Adds its entry
+        pstEntry = AddCompiledMapObject(stMap, orxConfig_GetString(szConfigScrollObjectName), i);
+        orxConfig_GetVector(szConfigScrollObjectPosition, &pstEntry->vPosition);
+        if(!orxConfig_GetVector(szConfigScrollObjectScale, &pstEntry->vScale))
+        {
+          orxVector_Copy(&pstEntry->vScale, &orxVECTOR_1);
+        }
+        pstEntry->fRotation = orxConfig_GetFloat(szConfigScrollObjectRotation);
+
+        // Has color or alpha?
+        if(orxConfig_HasValue(szConfigScrollObjectColor) || orxConfig_HasValue(szConfigScrollObjectAlpha))
+        {
+          pstEntry->u32Flags       |= CompiledObjectFlagColor;
+          pstEntry->stColor.fAlpha  = orxConfig_HasValue(szConfigScrollObjectAlpha) ? orxConfig_GetFloat(szConfigScrollObjectAlpha) : orxFLOAT_1;
+          if(!orxConfig_GetVector(szConfigScrollObjectColor, &pstEntry->stColor.vRGB))
+          {
+            orxVector_Copy(&pstEntry->stColor.vRGB, &orxVECTOR_WHITE);
+          }
+        }
+        if(orxConfig_GetBool(szConfigScrollObjectSmoothing))
+        {
+          pstEntry->u32Flags |= CompiledObjectFlagSmoothing;
+        }
+        if(orxConfig_GetBool(szConfigScrollObjectTiling))
+        {
+          pstEntry->u32Flags |= CompiledObjectFlagTiling;
+        }
+
+        // Pops config section
+        orxConfig_PopSection();
+
+        // Updates count
+        s32ScrollObjectCount++;
+      }
+    }
+
+    // Writes it
+    eResult = WriteCompiledMap(stMap, _zOutputName);
   }
 
   // Done!
   return eResult;
 }
 
-orxSTATUS ScrollBase::StopGame()
+orxBOOL ScrollBase::IsCompiledMap() const
 {
-  orxSTATUS eResult;
+  return mbCompiledMap;
+}
 
-  // Is running?
-  if(mbIsRunning)
+orxSTATUS ScrollBase::LoadCompiledMap()
+{
+  const orxSTRING zLocation;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  // Locates and opens map
+  if(((zLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, mzMapName)) != orxNULL)
+  && ((hResource = orxResource_Open(zLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
   {
-    // Updates result
-    eResult = orxSTATUS_SUCCESS;
+    CompiledMapHeader stHeader;
 
-    // Unpauses game
-    PauseGame(orxFALSE);
+    // Clears header
+    orxMemory_Zero(&stHeader, sizeof(CompiledMapHeader));
 
-    // Locks object list
-    mbObjectListLocked = orxTRUE;
-
-    // For all objects
-    for(ScrollObject *poObject = GetNextObject();
-        poObject;
-        poObject = GetNextObject(poObject))
+    // Is a compiled map?
+    if((orxResource_Read(hResource, sizeof(CompiledMapHeader), &stHeader, orxNULL, orxNULL) == (orxS64)sizeof(CompiledMapHeader))
+    && (stHeader.u32Magic == su32CompiledMapMagic))
     {
-      // Calls its callback
-      poObject->OnStopGame();
-    }
+      orxU8  *pu8Buffer = orxNULL;
+      orxU64  u64Size;
 
-    // Unlocks object list
-    mbObjectListLocked = orxFALSE;
+      // Gets content size (can't overflow on 64 bits)
+      u64Size = (orxU64)stHeader.u32CellNumber * sizeof(CompiledMapCell) + (orxU64)stHeader.u32ObjectNumber * sizeof(CompiledMapObject) + (orxU64)stHeader.u32StringSize;
 
-    // Updates running status
-    mbIsRunning = orxFALSE;
+      // Addressable?
+      if(u64Size == (orxU64)(orxU32)u64Size)
+      {
+        // Allocates content buffer
+        pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)u64Size, orxMEMORY_TYPE_MAIN);
+        orxASSERT(pu8Buffer);
+      }
 
-    // Calls stop game callback
-    OnStopGame();
-  }
-  else
-  {
-    // Updates result
-    eResult = orxSTATUS_FAILURE;
-  }
+      // Reads and validates it
+      if((pu8Buffer != orxNULL)
+      && (orxResource_Read(hResource, (orxS64)u64Size, pu8Buffer, orxNULL, orxNULL) == (orxS64)u64Size)
+      && (ValidateCompiledMap(stHeader, (const CompiledMapCell *)pu8Buffer, (const CompiledMapObject *)(pu8Buffer + stHeader.u32CellNumber * sizeof(CompiledMapCell)), (const orxCHAR *)(pu8Buffer + u64Size - stHeader.u32StringSize)) != orxSTATUS_FAILURE))
+      {
+        const CompiledMapCell  *astCellList;
+        CompiledMapObject      *astObjectList;
+        const orxCHAR          *acStringList;
 
-  // Done!
-  return eResult;
-}
+        // Gets cell, object & string lists
+        astCellList   = (const CompiledMapCell *)pu8Buffer;
+        astObjectList = (CompiledMapObject *)(astCellList + stHeader.u32CellNumber);
+        acStringList  = (const orxCHAR *)(astObjectList + stHeader.u32ObjectNumber);
 
-orxBOOL ScrollBase::IsGameRunning() const
-{
-  // Done!
-  return mbIsRunning;
-}
+        // Updates differential mode & cell size
+        mbDifferentialMode  = orxFLAG_TEST(stHeader.u32Flags, CompiledMapFlagDifferential);
+        mfStreamCellSize    = stHeader.fCellSize;
 
-orxSTATUS ScrollBase::PauseGame(orxBOOL _bPause)
-{
-  orxSTATUS eResult;
+        // For all objects
+        for(orxU32 i = 0; i < stHeader.u32ObjectNumber; i++)
+        {
+          // Updates next object ID
+          mu32NextObjectID = orxMAX(mu32NextObjectID, astObjectList[i].u32ID + 1);
+        }
 
-  // Change status?
-  if(_bPause != mbIsPaused)
-  {
-    // Disables physics simulation
-    orxPhysics_EnableSimulation(!_bPause);
+        // Streamed and not in editor mode?
+        if((stHeader.u32CellNumber != 0) && !IsEditorMode())
+        {
+          // Pushes scroll section
+          orxConfig_PushSection(szConfigSectionScroll);
+
+          // Gets streaming parameters
+          mfStreamMargin    = orxConfig_HasValue(szConfigStreamMargin) ? orxConfig_GetFloat(szConfigStreamMargin) : orx2F(0.5f) * mfStreamCellSize;
+          mu32StreamBudget  = orxConfig_HasValue(szConfigStreamBudget) ? orxConfig_GetU32(szConfigStreamBudget) : su32StreamBudget;
+
+          // Pops config section
+          orxConfig_PopSection();
+
+          // Keeps map content resident
+          mpu8StreamData          = pu8Buffer;
+          mastStreamObjectList    = astObjectList;
+          macStreamStringList     = acStringList;
+          mu32StreamActiveCount   = 0;
+          pu8Buffer               = orxNULL;
+
+          // Creates cells (objects can be handed over to cells that weren't part of the map when unloading)
+          mpstStreamCellBank      = orxBank_Create(stHeader.u32CellNumber, sizeof(StreamCell), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          mpstStreamCellTable     = orxHashTable_Create(stHeader.u32CellNumber, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          orxASSERT(mpstStreamCellBank && mpstStreamCellTable);
+
+          // For all cells
+          for(orxU32 i = 0; i < stHeader.u32CellNumber; i++)
+          {
+            StreamCell *pstCell;
 
-    // Locks object list
-    mbObjectListLocked = orxTRUE;
+            // Gets it
+            pstCell = GetStreamCell(astCellList[i].s32X, astCellList[i].s32Y);
 
-    // For all objects
-    for(ScrollObject *poObject = GetNextObject();
-        poObject;
-        poObject = GetNextObject(poObject))
-    {
-      // Is pausable?
-      if(poObject->TestFlags(ScrollObject::FlagPausable))
-      {
-        // Calls its callback
-        if(poObject->OnPauseGame(_bPause))
+            // For all its objects
+            for(orxU32 j = 0; j < astCellList[i].u32Count; j++)
+            {
+              // Adds its entry
+              AddStreamEntry(*pstCell, astCellList[i].u32First + j, 0);
+            }
+          }
+        }
+        else
         {
-          // Updates it
-          orxObject_Pause(poObject->GetOrxObject(), _bPause);
+          // For all objects
+          for(orxU32 i = 0; i < stHeader.u32ObjectNumber; i++)
+          {
+            // Creates it
+            CreateCompiledMapObject(astObjectList[i], acStringList);
+          }
         }
-      }
-    }
 
-    // Unlocks object list
-    mbObjectListLocked = orxFALSE;
+        // Has layer number?
+        if(orxFLAG_TEST(stHeader.u32Flags, CompiledMapFlagLayerNumber))
+        {
+          // Stores it
+          SetLayerNumber(stHeader.u32LayerNumber);
+        }
 
-    // Updates status
-    mbIsPaused = _bPause;
+        // Has camera position?
+        if(orxFLAG_TEST(stHeader.u32Flags, CompiledMapFlagCameraPosition))
+        {
+          // Updates camera position
+          orxCamera_SetPosition(mpstMainCamera, &stHeader.vCameraPosition);
+        }
 
-    // Updates result
-    eResult = orxSTATUS_SUCCESS;
+        // Has camera zoom?
+        if(orxFLAG_TEST(stHeader.u32Flags, CompiledMapFlagCameraZoom))
+        {
+          // Updates camera zoom
+          orxCamera_SetZoom(mpstMainCamera, stHeader.fCameraZoom);
+        }
 
-    // Calls pause game callback
-    OnPauseGame(_bPause);
-  }
-  else
-  {
-    // Updates result
-    eResult = orxSTATUS_FAILURE;
+        // Updates result
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        // Logs message
+        orxLOG("Couldn't load compiled map <%s>: invalid or truncated content.", mzMapName);
+      }
+
+      // Not kept?
+      if(pu8Buffer)
+      {
+        // Frees content buffer
+        orxMemory_Free(pu8Buffer);
+      }
+    }
+    // Compiled map from another version?
+    else if((stHeader.u32Magic & 0x00FFFFFF) == (su32CompiledMapMagic & 0x00FFFFFF))
+    {
+      // Logs message
+      orxLOG("Couldn't load compiled map <%s>: unsupported version <%c>, please recompile it.", mzMapName, (orxCHAR)(stHeader.u32Magic >> 24));
+    }
+
+    // Closes map
+    orxResource_Close(hResource);
   }
 
   // Done!
   return eResult;
 }
 
-orxBOOL ScrollBase::IsGamePaused() const
+orxSTATUS ScrollBase::ValidateCompiledMap(const CompiledMapHeader &_rstHeader, const CompiledMapCell *_astCellList, const CompiledMapObject *_astObjectList, const orxCHAR *_acStringList)
 {
-  // Done!
-  return mbIsPaused;
-}
+  orxSTATUS eResult;
 
-orxU32 ScrollBase::GetFrameCount() const
-{
-  // Done!
-  return mu32FrameCount;
-}
+  // Has a NUL-terminated string table and a usable cell size, if streamed?
+  eResult = ((_rstHeader.u32StringSize != 0)
+          && (_acStringList[_rstHeader.u32StringSize - 1] == orxCHAR_NULL)
+          && ((_rstHeader.u32CellNumber == 0) || (_rstHeader.fCellSize > orxFLOAT_0)))
+          ? orxSTATUS_SUCCESS
+          : orxSTATUS_FAILURE;
 
-orxVIEWPORT *ScrollBase::GetMainViewport() const
-{
-  // Done!
-  return mpstMainViewport;
-}
+  // For all objects
+  for(orxU32 i = 0; (eResult != orxSTATUS_FAILURE) && (i < _rstHeader.u32ObjectNumber); i++)
+  {
+    // Model name out of the string table?
+    if(_astObjectList[i].u32ModelOffset >= _rstHeader.u32StringSize)
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // For all cells
+  for(orxU32 i = 0; (eResult != orxSTATUS_FAILURE) && (i < _rstHeader.u32CellNumber); i++)
+  {
+    // Object range out of the object list?
+    if((_astCellList[i].u32First > _rstHeader.u32ObjectNumber)
+    || (_astCellList[i].u32Count > _rstHeader.u32ObjectNumber - _astCellList[i].u32First))
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
 
-orxCAMERA *ScrollBase::GetMainCamera() const
-{
   // Done!
-  return mpstMainCamera;
+  return eResult;
 }
 
-ScrollObject *ScrollBase::GetObject(orxU64 _u64GUID) const
+ScrollObject *ScrollBase::CreateCompiledMapObject(const CompiledMapObject &_rstEntry, const orxCHAR *_acStringList)
 {
-  orxOBJECT    *pstObject;
-  ScrollObject *poResult = orxNULL;
+  orxCHAR       acBuffer[32];
+  ScrollObject *poResult;
 
-  // Gets object
-  pstObject = orxOBJECT(orxStructure_Get(_u64GUID));
+  // Creates it
+  orxString_NPrint(acBuffer, sizeof(acBuffer), szConfigScrollObjectFormat, _rstEntry.u32ID);
+  poResult = CreateObject(_acStringList + _rstEntry.u32ModelOffset, ScrollObject::FlagSave, acBuffer);
 
   // Valid?
-  if(pstObject)
+  if(poResult)
   {
-    // Updates result
-    poResult = (ScrollObject *)orxObject_GetUserData(pstObject);
-  }
+    orxOBJECT *pstOrxObject;
 
-  // Done!
-  return poResult;
-}
+    // Gets internal object
+    pstOrxObject = poResult->GetOrxObject();
 
-ScrollObject *ScrollBase::GetNextObject(const ScrollObject *_poObject, orxBOOL _bChronological) const
-{
-  orxLINKLIST_NODE *pstNode;
-  ScrollObject     *poResult;
+    // Updates it
+    orxObject_SetPosition(pstOrxObject, &_rstEntry.vPosition);
+    orxObject_SetScale(pstOrxObject, &_rstEntry.vScale);
+    orxObject_SetRotation(pstOrxObject, _rstEntry.fRotation);
 
-  // Chronological order?
-  if(_bChronological)
-  {
-    // First one?
-    if(!_poObject)
-    {
-      // Gets its node
-      pstNode = orxLinkList_GetFirst(&mstObjectChronoList);
-    }
-    else
+    // Updates its differential mode
+    poResult->SetDifferentialMode(mbDifferentialMode);
+
+    // Has color?
+    if(orxFLAG_TEST(_rstEntry.u32Flags, CompiledObjectFlagColor))
     {
-      // Gets next node
-      pstNode = orxLinkList_GetNext(&_poObject->mstChronoNode);
+      // Applies it
+      poResult->SetColor(_rstEntry.stColor);
     }
 
-    // Updates result
-    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstChronoNode)) : (ScrollObject *)orxNULL;
-  }
-  else
-  {
-    // First one?
-    if(!_poObject)
+    // Updates its smoothing
+    if(orxFLAG_TEST(_rstEntry.u32Flags, CompiledObjectFlagSmoothing))
     {
-      // Gets its node
-      pstNode = orxLinkList_GetFirst(&mstObjectList);
+      orxObject_SetSmoothing(pstOrxObject, orxDISPLAY_SMOOTHING_ON);
+      poResult->SetFlags(ScrollObject::FlagSmoothed);
     }
     else
     {
-      // Gets next node
-      pstNode = orxLinkList_GetNext(&_poObject->mstNode);
+      orxObject_SetSmoothing(pstOrxObject, orxDISPLAY_SMOOTHING_OFF);
     }
 
-    // Updates result
-    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstNode)) : (ScrollObject *)orxNULL;
-  }
-
-  // Done!
-  return poResult;
-}
-
-ScrollObject *ScrollBase::GetPreviousObject(const ScrollObject *_poObject, orxBOOL _bChronological) const
-{
-  orxLINKLIST_NODE *pstNode;
-  ScrollObject     *poResult;
-
-  // Chronological order?
-  if(_bChronological)
-  {
-    // Last one?
-    if(!_poObject)
+    // Updates its tiling
+    if(orxFLAG_TEST(_rstEntry.u32Flags, CompiledObjectFlagTiling))
     {
-      // Gets its node
-      pstNode = orxLinkList_GetLast(&mstObjectChronoList);
+      orxObject_SetRepeat(pstOrxObject, orxMath_Abs(_rstEntry.vScale.fX), orxMath_Abs(_rstEntry.vScale.fY));
+      poResult->SetFlags(ScrollObject::FlagTiled);
     }
     else
     {
-      // Gets previous node
-      pstNode = orxLinkList_GetPrevious(&_poObject->mstChronoNode);
+      orxObject_SetRepeat(pstOrxObject, orxFLOAT_1, orxFLOAT_1);
     }
-
-    // Updates result
-    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstChronoNode)) : (ScrollObject *)orxNULL;
   }
   else
   {
-    // Last one?
-    if(!_poObject)
-    {
-      // Gets its node
-      pstNode = orxLinkList_GetLast(&mstObjectList);
-    }
-    else
-    {
-      // Gets previous node
-      pstNode = orxLinkList_GetPrevious(&_poObject->mstNode);
-    }
-
-    // Updates result
-    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstNode)) : (ScrollObject *)orxNULL;
+    // Logs message
+    orxLOG("Couldn't load object [%s]: invalid model <%s>.", acBuffer, _acStringList + _rstEntry.u32ModelOffset);
   }
 
   // Done!
   return poResult;
 }
 
-void ScrollBase::SetEditorMode(orxBOOL _bEnable)
+void ScrollBase::UpdateStreaming()
 {
-  mbEditorMode = _bEnable;
-}
+  // Streaming?
+  if(mpstStreamCellBank)
+  {
+    orxAABOX  stFrustum;
+    orxVECTOR vPos;
+    orxFLOAT  fZoom;
+    orxU32    u32Budget;
 
-orxBOOL ScrollBase::IsEditorMode() const
-{
-  return mbEditorMode;
-}
+    // Updates stamp
+    mu32StreamStamp++;
 
-void ScrollBase::SetDifferentialMode(orxBOOL _bEnable)
-{
-  mbDifferentialMode = _bEnable;
-}
+    // Gets camera frustum, position & zoom
+    orxCamera_GetFrustum(mpstMainCamera, &stFrustum);
+    orxCamera_GetPosition(mpstMainCamera, &vPos);
+    fZoom = orxCamera_GetZoom(mpstMainCamera);
 
-orxBOOL ScrollBase::IsDifferentialMode() const
-{
-  return mbDifferentialMode;
-}
+    // Gets covered cells, including margin
+    ms32StreamMinX = (orxS32)orxMath_Floor((vPos.fX + stFrustum.vTL.fX / fZoom - mfStreamMargin) / mfStreamCellSize);
+    ms32StreamMinY = (orxS32)orxMath_Floor((vPos.fY + stFrustum.vTL.fY / fZoom - mfStreamMargin) / mfStreamCellSize);
+    ms32StreamMaxX = (orxS32)orxMath_Floor((vPos.fX + stFrustum.vBR.fX / fZoom + mfStreamMargin) / mfStreamCellSize);
+    ms32StreamMaxY = (orxS32)orxMath_Floor((vPos.fY + stFrustum.vBR.fY / fZoom + mfStreamMargin) / mfStreamCellSize);
 
-orxSTATUS ScrollBase::BaseInit()
-{
-  orxCLOCK *pstCoreClock;
-  orxSTATUS eResult;
+    // For all covered cells
+    for(orxS32 j = ms32StreamMinY; j <= ms32StreamMaxY; j++)
+    {
+      for(orxS32 i = ms32StreamMinX; i <= ms32StreamMaxX; i++)
+      {
+        StreamCell *pstCell;
 
-  // Binds default ScrollObject section
-  orxConfig_PushSection(szConfigSectionScrollObject);
-  orxConfig_PopSection();
-  ScrollBindObject<ScrollObject>(szConfigSectionScrollObject);
+        // Has content?
+        if((pstCell = (StreamCell *)orxHashTable_Get(mpstStreamCellTable, GetCellKey(i, j))) != orxNULL)
+        {
+          // Not active?
+          if(pstCell->u32Stamp == 0)
+          {
+            // Activates it
+            ActivateStreamCell(*pstCell);
+          }
 
-  // Binds objects
-  BindObjects();
+          // Marks it as visible
+          pstCell->u32Stamp = mu32StreamStamp;
+        }
+      }
+    }
 
-  // Selects map section
-  orxConfig_SelectSection(szConfigSectionMap);
+    // For all active cells
+    u32Budget = mu32StreamBudget;
+    for(orxU32 i = 0; i < mu32StreamActiveCount;)
+    {
+      StreamCell *pstCell;
 
-  // Gets core clock
-  pstCoreClock = orxClock_Get(orxCLOCK_KZ_CORE);
+      // Gets it
+      pstCell = mapstStreamActiveList[i];
 
-  // Registers update function
-  eResult = ((orxClock_Register(pstCoreClock, StaticUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL) != orxSTATUS_FAILURE)
-          && (orxClock_Register(pstCoreClock, StaticCameraUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+      // Not visible anymore?
+      if(pstCell->u32Stamp != mu32StreamStamp)
+      {
+        // Unloads it (can activate the visible cells its objects moved to)
+        UnloadStreamCell(*pstCell);
 
-  // Successful?
+        // Removes it from active list
+        mapstStreamActiveList[i] = mapstStreamActiveList[--mu32StreamActiveCount];
+      }
+      else
+      {
+        // Not fully loaded?
+        if(pstCell->u32Loaded < pstCell->u32Count)
+        {
+          // While there's budget left
+          for(; (u32Budget != 0) && (pstCell->u32Loaded < pstCell->u32Count); pstCell->u32Loaded++)
+          {
+            const CompiledMapObject  *pstEntry;
+            ScrollObject             *poObject = orxNULL;
+
+            // Gets its entry
+            pstEntry = &mastStreamObjectList[pstCell->au32EntryList[pstCell->u32Loaded]];
+
+            // Not deleted?
+            if(!orxFLAG_TEST(pstEntry->u32Flags, CompiledObjectFlagDeleted))
+            {
+              // Creates it
+              poObject = CreateCompiledMapObject(*pstEntry, macStreamStringList);
+              u32Budget--;
+            }
+
+            // Stores its GUID
+            pstCell->au64GUIDList[pstCell->u32Loaded] = poObject ? poObject->GetGUID() : 0;
+          }
+        }
+
+        // Next cell
+        i++;
+      }
+    }
+  }
+}
+
+ScrollBase::StreamCell *ScrollBase::GetStreamCell(orxS32 _s32X, orxS32 _s32Y)
+{
+  StreamCell *pstResult;
+  orxU64      u64Key;
+
+  // Gets its key
+  u64Key = GetCellKey(_s32X, _s32Y);
+
+  // Not created yet?
+  if((pstResult = (StreamCell *)orxHashTable_Get(mpstStreamCellTable, u64Key)) == orxNULL)
+  {
+    // Creates it
+    pstResult = (StreamCell *)orxBank_Allocate(mpstStreamCellBank);
+    orxASSERT(pstResult);
+    orxMemory_Zero(pstResult, sizeof(StreamCell));
+    pstResult->s32X = _s32X;
+    pstResult->s32Y = _s32Y;
+
+    // Adds it to table
+    orxHashTable_Add(mpstStreamCellTable, u64Key, pstResult);
+  }
+
+  // Done!
+  return pstResult;
+}
+
+void ScrollBase::ActivateStreamCell(StreamCell &_rstCell)
+{
+  // Full?
+  if(mu32StreamActiveCount == mu32StreamActiveSize)
+  {
+    // Grows active list
+    mu32StreamActiveSize  = mu32StreamActiveSize ? mu32StreamActiveSize << 1 : su32UpdateListSize;
+    mapstStreamActiveList = (StreamCell **)orxMemory_Reallocate(mapstStreamActiveList, mu32StreamActiveSize * sizeof(StreamCell *), orxMEMORY_TYPE_MAIN);
+    orxASSERT(mapstStreamActiveList);
+  }
+
+  // Adds it
+  mapstStreamActiveList[mu32StreamActiveCount++] = &_rstCell;
+}
+
+void ScrollBase::AddStreamEntry(StreamCell &_rstCell, orxU32 _u32Entry, orxU64 _u64GUID)
+{
+  // Full?
+  if(_rstCell.u32Count == _rstCell.u32Size)
+  {
+    // Grows entry & GUID lists
+    _rstCell.u32Size        = _rstCell.u32Size ? _rstCell.u32Size << 1 : 8;
+    _rstCell.au32EntryList  = (orxU32 *)orxMemory_Reallocate(_rstCell.au32EntryList, _rstCell.u32Size * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+    _rstCell.au64GUIDList   = (orxU64 *)orxMemory_Reallocate(_rstCell.au64GUIDList, _rstCell.u32Size * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+    orxASSERT(_rstCell.au32EntryList && _rstCell.au64GUIDList);
+  }
+
+  // Loaded?
+  if(_u64GUID != 0)
+  {
+    // Moves first unloaded entry to the end
+    _rstCell.au32EntryList[_rstCell.u32Count] = _rstCell.au32EntryList[_rstCell.u32Loaded];
+
+    // Stores it with the loaded ones
+    _rstCell.au32EntryList[_rstCell.u32Loaded]  = _u32Entry;
+    _rstCell.au64GUIDList[_rstCell.u32Loaded]   = _u64GUID;
+    _rstCell.u32Loaded++;
+  }
+  else
+  {
+    // Stores it with the unloaded ones
+    _rstCell.au32EntryList[_rstCell.u32Count] = _u32Entry;
+  }
+
+  // Updates count
+  _rstCell.u32Count++;
+}
+
+void ScrollBase::UnloadStreamCell(StreamCell &_rstCell)
+{
+  orxU32 u32Count = 0;
+
+  // For all its objects
+  for(orxU32 i = 0; i < _rstCell.u32Count; i++)
+  {
+    CompiledMapObject  *pstEntry;
+    ScrollObject       *poObject;
+    orxU32              u32Entry;
+
+    // Gets its entry
+    u32Entry = _rstCell.au32EntryList[i];
+    pstEntry = &mastStreamObjectList[u32Entry];
+
+    // Not loaded?
+    if(i >= _rstCell.u32Loaded)
+    {
+      // Keeps it
+      _rstCell.au32EntryList[u32Count++] = u32Entry;
+    }
+    // Still alive?
+    else if((_rstCell.au64GUIDList[i] != 0) && ((poObject = GetObject(_rstCell.au64GUIDList[i])) != orxNULL))
+    {
+      orxOBJECT  *pstOrxObject;
+      orxS32      s32X, s32Y;
+
+      // Gets internal object
+      pstOrxObject = poObject->GetOrxObject();
+
+      // Stores its current state
+      orxObject_GetPosition(pstOrxObject, &pstEntry->vPosition);
+      orxObject_GetScale(pstOrxObject, &pstEntry->vScale);
+      pstEntry->fRotation = orxObject_GetRotation(pstOrxObject);
+
+      // Gets its current cell
+      s32X = (orxS32)orxMath_Floor(pstEntry->vPosition.fX / mfStreamCellSize);
+      s32Y = (orxS32)orxMath_Floor(pstEntry->vPosition.fY / mfStreamCellSize);
+
+      // Still in this cell?
+      if((s32X == _rstCell.s32X) && (s32Y == _rstCell.s32Y))
+      {
+        // Deletes it
+        DeleteObject(poObject);
+
+        // Keeps it
+        _rstCell.au32EntryList[u32Count++] = u32Entry;
+      }
+      else
+      {
+        StreamCell *pstCell;
+
+        // Gets the cell it moved to
+        pstCell = GetStreamCell(s32X, s32Y);
+
+        // Visible?
+        if((s32X >= ms32StreamMinX) && (s32X <= ms32StreamMaxX) && (s32Y >= ms32StreamMinY) && (s32Y <= ms32StreamMaxY))
+        {
+          // Not active?
+          if(pstCell->u32Stamp == 0)
+          {
+            // Activates it
+            ActivateStreamCell(*pstCell);
+            pstCell->u32Stamp = mu32StreamStamp;
+          }
+
+          // Hands the live object over to it
+          AddStreamEntry(*pstCell, u32Entry, _rstCell.au64GUIDList[i]);
+        }
+        else
+        {
+          // Deletes it
+          DeleteObject(poObject);
+
+          // Hands its entry over to it
+          AddStreamEntry(*pstCell, u32Entry, 0);
+        }
+      }
+    }
+    else
+    {
+      // Don't load it again
+      pstEntry->u32Flags |= CompiledObjectFlagDeleted;
+    }
+  }
+
+  // Resets it
+  _rstCell.u32Count   = u32Count;
+  _rstCell.u32Loaded  = 0;
+  _rstCell.u32Stamp   = 0;
+}
+
+void ScrollBase::StopStreaming()
+{
+  // Streaming?
+  if(mpstStreamCellBank)
+  {
+    // For all cells
+    for(StreamCell *pstCell = (StreamCell *)orxBank_GetNext(mpstStreamCellBank, orxNULL);
+        pstCell;
+        pstCell = (StreamCell *)orxBank_GetNext(mpstStreamCellBank, pstCell))
+    {
+      // Has lists?
+      if(pstCell->au32EntryList)
+      {
+        // Deletes them
+        orxMemory_Free(pstCell->au32EntryList);
+        orxMemory_Free(pstCell->au64GUIDList);
+      }
+    }
+
+    // Has active list?
+    if(mapstStreamActiveList)
+    {
+      // Deletes it
+      orxMemory_Free(mapstStreamActiveList);
+    }
+
+    // Deletes all
+    orxHashTable_Delete(mpstStreamCellTable);
+    orxBank_Delete(mpstStreamCellBank);
+    orxMemory_Free(mpu8StreamData);
+    mpstStreamCellTable   = orxNULL;
+    mapstStreamActiveList = orxNULL;
+    mpstStreamCellBank    = orxNULL;
+    mpu8StreamData        = orxNULL;
+    mastStreamObjectList  = orxNULL;
+    macStreamStringList   = orxNULL;
+    mu32StreamActiveSize  = mu32StreamActiveCount = 0;
+  }
+}
+
+ScrollBase::CompiledMapObject *ScrollBase::AddCompiledMapObject(CompiledMap &_rstMap, const orxSTRING _zModelName, orxU32 _u32ID)
+{
+  CompiledMapObject  *pstResult;
+  orxSTRINGID         stID;
+  orxU32              u32Offset;
+
+  // Full?
+  if(_rstMap.stHeader.u32ObjectNumber == _rstMap.u32ObjectSize)
+  {
+    // Grows object list
+    _rstMap.u32ObjectSize = _rstMap.u32ObjectSize ? _rstMap.u32ObjectSize << 1 : su32UpdateListSize;
+    _rstMap.astObjectList = (CompiledMapObject *)orxMemory_Reallocate(_rstMap.astObjectList, _rstMap.u32ObjectSize * sizeof(CompiledMapObject), orxMEMORY_TYPE_MAIN);
+    orxASSERT(_rstMap.astObjectList);
+  }
+
+  // No string table yet?
+  if(!_rstMap.pstStringTable)
+  {
+    // Creates it
+    _rstMap.pstStringTable = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  }
+
+  // Gets model's offset (stored + 1)
+  stID = orxString_Hash(_zModelName);
+  if((u32Offset = (orxU32)(orxUPTR)orxHashTable_Get(_rstMap.pstStringTable, stID)) == 0)
+  {
+    orxU32 u32Length;
+
+    // Gets its length
+    u32Length = orxString_GetLength(_zModelName) + 1;
+
+    // Not enough room?
+    if(_rstMap.stHeader.u32StringSize + u32Length > _rstMap.u32StringCapacity)
+    {
+      // Grows string list
+      _rstMap.u32StringCapacity = orxMAX(_rstMap.u32StringCapacity << 1, _rstMap.stHeader.u32StringSize + u32Length);
+      _rstMap.acStringList      = (orxCHAR *)orxMemory_Reallocate(_rstMap.acStringList, _rstMap.u32StringCapacity, orxMEMORY_TYPE_MAIN);
+      orxASSERT(_rstMap.acStringList);
+    }
+
+    // Stores it
+    orxMemory_Copy(_rstMap.acStringList + _rstMap.stHeader.u32StringSize, _zModelName, u32Length);
+    u32Offset = _rstMap.stHeader.u32StringSize + 1;
+    _rstMap.stHeader.u32StringSize += u32Length;
+    orxHashTable_Add(_rstMap.pstStringTable, stID, (void *)(orxUPTR)u32Offset);
+  }
+
+  // Inits new entry
+  pstResult = &_rstMap.astObjectList[_rstMap.stHeader.u32ObjectNumber++];
+  orxMemory_Zero(pstResult, sizeof(CompiledMapObject));
+  pstResult->u32ModelOffset = u32Offset - 1;
+  pstResult->u32ID          = _u32ID;
+
+  // Done!
+  return pstResult;
+}
+
+orxSTATUS ScrollBase::WriteCompiledMap(CompiledMap &_rstMap, const orxSTRING _zFileName)
+{
+  const orxSTRING zLocation;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  // Stores magic
+  _rstMap.stHeader.u32Magic = su32CompiledMapMagic;
+
+  // Streamed?
+  if((_rstMap.stHeader.fCellSize > orxFLOAT_0) && (_rstMap.stHeader.u32ObjectNumber != 0))
+  {
+    // Partitions its objects
+    PartitionCompiledMap(_rstMap);
+  }
+
+  // Opens output
+  if(((zLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, _zFileName)) != orxNULL)
+  && ((hResource = orxResource_Open(zLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+  {
+    orxS64 s64CellSize, s64ObjectSize;
+
+    // Writes header, cell, object & string lists
+    s64CellSize   = (orxS64)_rstMap.stHeader.u32CellNumber * sizeof(CompiledMapCell);
+    s64ObjectSize = (orxS64)_rstMap.stHeader.u32ObjectNumber * sizeof(CompiledMapObject);
+    if((orxResource_Write(hResource, sizeof(CompiledMapHeader), &_rstMap.stHeader, orxNULL, orxNULL) == (orxS64)sizeof(CompiledMapHeader))
+    && (orxResource_Write(hResource, s64CellSize, _rstMap.astCellList, orxNULL, orxNULL) == s64CellSize)
+    && (orxResource_Write(hResource, s64ObjectSize, _rstMap.astObjectList, orxNULL, orxNULL) == s64ObjectSize)
+    && (orxResource_Write(hResource, _rstMap.stHeader.u32StringSize, _rstMap.acStringList, orxNULL, orxNULL) == (orxS64)_rstMap.stHeader.u32StringSize))
+    {
+      // Updates result
+      eResult = orxSTATUS_SUCCESS;
+    }
+
+    // Closes output
+    orxResource_Close(hResource);
+  }
+
+  // Failure?
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    // Logs message
+    orxLOG("Couldn't write compiled map <%s>.", _zFileName);
+  }
+
+  // Frees lists
+  if(_rstMap.astCellList)
+  {
+    orxMemory_Free(_rstMap.astCellList);
+  }
+  if(_rstMap.astObjectList)
+  {
+    orxMemory_Free(_rstMap.astObjectList);
+  }
+  if(_rstMap.acStringList)
+  {
+    orxMemory_Free(_rstMap.acStringList);
+  }
+  if(_rstMap.pstStringTable)
+  {
+    orxHashTable_Delete(_rstMap.pstStringTable);
+  }
+  orxMemory_Zero(&_rstMap, sizeof(CompiledMap));
+
+  // Done!
+  return eResult;
+}
+
+void ScrollBase::PartitionCompiledMap(CompiledMap &_rstMap)
+{
+  CompiledMapObject  *astSortedList;
+  orxHASHTABLE       *pstTable;
+  orxU32             *au32CellList, *au32CursorList;
+  orxU32              u32CellSize = 0;
+
+  // Creates cell table & object cell list
+  pstTable      = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  au32CellList  = (orxU32 *)orxMemory_Allocate(_rstMap.stHeader.u32ObjectNumber * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+  orxASSERT(pstTable && au32CellList);
+
+  // For all objects
+  _rstMap.stHeader.u32CellNumber = 0;
+  for(orxU32 i = 0; i < _rstMap.stHeader.u32ObjectNumber; i++)
+  {
+    orxU64  u64Key;
+    orxS32  s32X, s32Y;
+    orxU32  u32Index;
+
+    // Gets its cell
+    s32X    = (orxS32)orxMath_Floor(_rstMap.astObjectList[i].vPosition.fX / _rstMap.stHeader.fCellSize);
+    s32Y    = (orxS32)orxMath_Floor(_rstMap.astObjectList[i].vPosition.fY / _rstMap.stHeader.fCellSize);
+    u64Key  = GetCellKey(s32X, s32Y);
+
+    // New cell? (index stored + 1)
+    if((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(pstTable, u64Key)) == 0)
+    {
+      // Full?
+      if(_rstMap.stHeader.u32CellNumber == u32CellSize)
+      {
+        // Grows cell list
+        u32CellSize         = u32CellSize ? u32CellSize << 1 : su32UpdateListSize;
+        _rstMap.astCellList = (CompiledMapCell *)orxMemory_Reallocate(_rstMap.astCellList, u32CellSize * sizeof(CompiledMapCell), orxMEMORY_TYPE_MAIN);
+        orxASSERT(_rstMap.astCellList);
+      }
+
+      // Inits it
+      u32Index = ++_rstMap.stHeader.u32CellNumber;
+      _rstMap.astCellList[u32Index - 1].s32X      = s32X;
+      _rstMap.astCellList[u32Index - 1].s32Y      = s32Y;
+      _rstMap.astCellList[u32Index - 1].u32First  = 0;
+      _rstMap.astCellList[u32Index - 1].u32Count  = 0;
+      orxHashTable_Add(pstTable, u64Key, (void *)(orxUPTR)u32Index);
+    }
+
+    // Updates cell count
+    _rstMap.astCellList[u32Index - 1].u32Count++;
+    au32CellList[i] = u32Index - 1;
+  }
+
+  // Computes cell offsets
+  au32CursorList = (orxU32 *)orxMemory_Allocate(_rstMap.stHeader.u32CellNumber * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+  orxASSERT(au32CursorList);
+  for(orxU32 i = 0, u32Offset = 0; i < _rstMap.stHeader.u32CellNumber; i++)
+  {
+    _rstMap.astCellList[i].u32First = au32CursorList[i] = u32Offset;
+    u32Offset += _rstMap.astCellList[i].u32Count;
+  }
+
+  // Sorts objects by cell
+  astSortedList = (CompiledMapObject *)orxMemory_Allocate(_rstMap.u32ObjectSize * sizeof(CompiledMapObject), orxMEMORY_TYPE_MAIN);
+  orxASSERT(astSortedList);
+  for(orxU32 i = 0; i < _rstMap.stHeader.u32ObjectNumber; i++)
+  {
+    orxMemory_Copy(&astSortedList[au32CursorList[au32CellList[i]]++], &_rstMap.astObjectList[i], sizeof(CompiledMapObject));
+  }
+  orxMemory_Free(_rstMap.astObjectList);
+  _rstMap.astObjectList = astSortedList;
+
+  // Deletes temporary data
+  orxMemory_Free(au32CursorList);
+  orxMemory_Free(au32CellList);
+  orxHashTable_Delete(pstTable);
+}
+
+orxSTATUS ScrollBase::ResetMap()
+{
+  orxVECTOR vPos;
+  orxFLOAT  fZoom;
+  orxSTATUS eResult;
+
+  // Backups camera position & zoom
+  orxCamera_GetPosition(mpstMainCamera, &vPos);
+  fZoom = orxCamera_GetZoom(mpstMainCamera);
+
+  // Reloads it
+  eResult = LoadMap();
+
+  // Restores main camera position & zoom
+  orxCamera_SetPosition(mpstMainCamera, &vPos);
+  orxCamera_SetZoom(mpstMainCamera, fZoom);
+
+  // Done!
+  return eResult;
+}
+
+void ScrollBase::SetLayerNumber(orxU32 _u32LayerNumber)
+{
+  orxAABOX    stFrustum;
+  orxVECTOR   vPos;
+  orxFLOAT    fDepth, fWidth, fHeight;
+  orxCAMERA  *pstCamera;
+
+  // Is even?
+  if(!(_u32LayerNumber & 1))
+  {
+    // Adds an extra layer
+    mu32LayerNumber = _u32LayerNumber + 1;
+
+    // Logs message
+    orxLOG("Can't use an even number of layers, adding an extra one => %d layers will be used.", mu32LayerNumber);
+  }
+  else
+  {
+    // Stores it
+    mu32LayerNumber = _u32LayerNumber;
+  }
+
+  // Gets main camera
+  pstCamera = GetMainCamera();
+
+  // Gets its frustum & position
+  orxCamera_GetFrustum(pstCamera, &stFrustum);
+  orxCamera_GetPosition(pstCamera, &vPos);
+
+  // Gets its size & depth
+  fWidth  = stFrustum.vBR.fX - stFrustum.vTL.fX;
+  fHeight = stFrustum.vBR.fY - stFrustum.vTL.fY;
+  fDepth  = stFrustum.vBR.fZ - stFrustum.vTL.fZ;
+
+  // Calculates correct position for the camera
+  vPos.fZ = -orx2F(0.5f) * fDepth;
+
+  // Updates camera position
+  orxCamera_SetPosition(pstCamera, &vPos);
+
+  // Updates camera frustum
+  orxCamera_SetFrustum(pstCamera, fWidth, fHeight, orxFLOAT_0, fDepth);
+}
+
+orxU32 ScrollBase::GetLayerNumber() const
+{
+  // Done!
+  return mu32LayerNumber;
+}
+
+orxU32 ScrollBase::GetLayer(const orxVECTOR &_rvPosition) const
+{
+  orxAABOX  stFrustum;
+  orxVECTOR vCameraPos;
+  orxU32    u32Result;
+
+  // Gets asbolute frustum
+  orxCamera_GetFrustum(GetMainCamera(), &stFrustum);
+  orxCamera_GetPosition(GetMainCamera(), &vCameraPos);
+  orxVector_Add(&(stFrustum.vTL), &(stFrustum.vTL), &vCameraPos);
+  orxVector_Add(&(stFrustum.vBR), &(stFrustum.vBR), &vCameraPos);
+
+  // Updates result
+  u32Result = orxF2U((_rvPosition.fZ - stFrustum.vTL.fZ) / (stFrustum.vBR.fZ - stFrustum.vTL.fZ) * orxU2F(mu32LayerNumber));
+
+  // Done!
+  return u32Result;
+}
+
+orxFLOAT ScrollBase::GetLayerDepth(orxU32 _u32Layer) const
+{
+  orxAABOX stFrustum;
+  orxFLOAT fResult;
+
+  // Corrects range
+  _u32Layer = orxMIN(_u32Layer, mu32LayerNumber);
+
+  // Gets camera depth
+  orxCamera_GetFrustum(GetMainCamera(), &stFrustum);
+
+  // Game layer?
+  if(((mu32LayerNumber - 1) >> 1) == _u32Layer)
+  {
+    fResult = orxFLOAT_0;
+  }
+  else
+  {
+    orxVECTOR vCameraPos;
+
+    // Gets camera position
+    orxCamera_GetPosition(GetMainCamera(), &vCameraPos);
+
+    // Updates result
+    fResult = orxLERP(stFrustum.vTL.fZ, stFrustum.vBR.fZ, (orxU2F(_u32Layer) + orx2F(0.5f)) / orxU2F(mu32LayerNumber)) + vCameraPos.fZ;
+  }
+
+  // Done!
+  return fResult;
+}
+
+orxSTATUS ScrollBase::StartGame()
+{
+  orxSTATUS eResult;
+
+  // Not already running?
+  if(!mbIsRunning)
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // Locks object list
+    mbObjectListLocked = orxTRUE;
+
+    // For all objects
+    for(ScrollObject *poObject = GetNextObject();
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Calls its callback
+      poObject->OnStartGame();
+    }
+
+    // Unlocks object list
+    mbObjectListLocked = orxFALSE;
+
+    // Updates running status
+    mbIsRunning = orxTRUE;
+
+    // Calls start game callback
+    OnStartGame();
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxSTATUS ScrollBase::StopGame()
+{
+  orxSTATUS eResult;
+
+  // Is running?
+  if(mbIsRunning)
+  {
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // Unpauses game
+    PauseGame(orxFALSE);
+
+    // Locks object list
+    mbObjectListLocked = orxTRUE;
+
+    // For all objects
+    for(ScrollObject *poObject = GetNextObject();
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Calls its callback
+      poObject->OnStopGame();
+    }
+
+    // Unlocks object list
+    mbObjectListLocked = orxFALSE;
+
+    // Updates running status
+    mbIsRunning = orxFALSE;
+
+    // Calls stop game callback
+    OnStopGame();
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxBOOL ScrollBase::IsGameRunning() const
+{
+  // Done!
+  return mbIsRunning;
+}
+
+orxSTATUS ScrollBase::PauseGame(orxBOOL _bPause)
+{
+  orxSTATUS eResult;
+
+  // Change status?
+  if(_bPause != mbIsPaused)
+  {
+    // Disables physics simulation
+    orxPhysics_EnableSimulation(!_bPause);
+
+    // Locks object list
+    mbObjectListLocked = orxTRUE;
+
+    // For all objects
+    for(ScrollObject *poObject = GetNextObject();
+        poObject;
+        poObject = GetNextObject(poObject))
+    {
+      // Is pausable?
+      if(poObject->TestFlags(ScrollObject::FlagPausable))
+      {
+        // Calls its callback
+        if(poObject->OnPauseGame(_bPause))
+        {
+          // Updates it
+          orxObject_Pause(poObject->GetOrxObject(), _bPause);
+        }
+      }
+    }
+
+    // Unlocks object list
+    mbObjectListLocked = orxFALSE;
+
+    // Updates status
+    mbIsPaused = _bPause;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // Calls pause game callback
+    OnPauseGame(_bPause);
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxBOOL ScrollBase::IsGamePaused() const
+{
+  // Done!
+  return mbIsPaused;
+}
+
+orxU32 ScrollBase::GetFrameCount() const
+{
+  // Done!
+  return mu32FrameCount;
+}
+
+orxU32 ScrollBase::GetSkippedEventCount() const
+{
+  // Done!
+  return mu32SkippedEventCount;
+}
+
+// To call after changing section parents at runtime (orxConfig_SetParent), loads and reloads are handled internally
+void ScrollBase::ClearBinderCache()
+{
+  // Invalidates resolved binders
+  ScrollObjectBinderBase::ClearCache();
+}
+
+orxVIEWPORT *ScrollBase::GetMainViewport() const
+{
+  // Done!
+  return mpstMainViewport;
+}
+
+orxCAMERA *ScrollBase::GetMainCamera() const
+{
+  // Done!
+  return mpstMainCamera;
+}
+
+ScrollObject *ScrollBase::GetObject(orxU64 _u64GUID) const
+{
+  orxOBJECT    *pstObject;
+  ScrollObject *poResult = orxNULL;
+
+  // Gets object
+  pstObject = orxOBJECT(orxStructure_Get(_u64GUID));
+
+  // Valid?
+  if(pstObject)
+  {
+    // Updates result
+    poResult = (ScrollObject *)orxObject_GetUserData(pstObject);
+  }
+
+  // Done!
+  return poResult;
+}
+
+ScrollObject *ScrollBase::GetNextObject(const ScrollObject *_poObject, orxBOOL _bChronological) const
+{
+  orxLINKLIST_NODE *pstNode;
+  ScrollObject     *poResult;
+
+  // Chronological order?
+  if(_bChronological)
+  {
+    // First one?
+    if(!_poObject)
+    {
+      // Gets its node
+      pstNode = orxLinkList_GetFirst(&mstObjectChronoList);
+    }
+    else
+    {
+      // Gets next node
+      pstNode = orxLinkList_GetNext(&_poObject->mstChronoNode);
+    }
+
+    // Updates result
+    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstChronoNode)) : (ScrollObject *)orxNULL;
+  }
+  else
+  {
+    // First one?
+    if(!_poObject)
+    {
+      // Gets its node
+      pstNode = orxLinkList_GetFirst(&mstObjectList);
+    }
+    else
+    {
+      // Gets next node
+      pstNode = orxLinkList_GetNext(&_poObject->mstNode);
+    }
+
+    // Updates result
+    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstNode)) : (ScrollObject *)orxNULL;
+  }
+
+  // Done!
+  return poResult;
+}
+
+ScrollObject *ScrollBase::GetPreviousObject(const ScrollObject *_poObject, orxBOOL _bChronological) const
+{
+  orxLINKLIST_NODE *pstNode;
+  ScrollObject     *poResult;
+
+  // Chronological order?
+  if(_bChronological)
+  {
+    // Last one?
+    if(!_poObject)
+    {
+      // Gets its node
+      pstNode = orxLinkList_GetLast(&mstObjectChronoList);
+    }
+    else
+    {
+      // Gets previous node
+      pstNode = orxLinkList_GetPrevious(&_poObject->mstChronoNode);
+    }
+
+    // Updates result
+    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstChronoNode)) : (ScrollObject *)orxNULL;
+  }
+  else
+  {
+    // Last one?
+    if(!_poObject)
+    {
+      // Gets its node
+      pstNode = orxLinkList_GetLast(&mstObjectList);
+    }
+    else
+    {
+      // Gets previous node
+      pstNode = orxLinkList_GetPrevious(&_poObject->mstNode);
+    }
+
+    // Updates result
+    poResult = pstNode ? (ScrollObject *)((orxU8 *)pstNode - offsetof(ScrollObject, mstNode)) : (ScrollObject *)orxNULL;
+  }
+
+  // Done!
+  return poResult;
+}
+
+orxU32 ScrollBase::GetObjectCount(const orxSTRING _zSectionName) const
+{
+  ScrollObjectBinderBase *poBinder;
+  orxU32                  u32Result;
+
+  // Gets binder
+  poBinder = ScrollObjectBinderBase::GetBinder(_zSectionName);
+
+  // Updates result
+  u32Result = poBinder ? poBinder->GetObjectCount() : 0;
+
+  // Done!
+  return u32Result;
+}
+
+ScrollObject *ScrollBase::GetObjectAt(const orxSTRING _zSectionName, orxU32 _u32Index) const
+{
+  ScrollObjectBinderBase *poBinder;
+  ScrollObject           *poResult;
+
+  // Gets binder
+  poBinder = ScrollObjectBinderBase::GetBinder(_zSectionName);
+
+  // Updates result
+  poResult = poBinder ? poBinder->GetObjectAt(_u32Index) : orxNULL;
+
+  // Done!
+  return poResult;
+}
+
+void ScrollBase::SetEditorMode(orxBOOL _bEnable)
+{
+  mbEditorMode = _bEnable;
+}
+
+orxBOOL ScrollBase::IsEditorMode() const
+{
+  return mbEditorMode;
+}
+
+void ScrollBase::SetDifferentialMode(orxBOOL _bEnable)
+{
+  mbDifferentialMode = _bEnable;
+}
+
+orxBOOL ScrollBase::IsDifferentialMode() const
+{
+  return mbDifferentialMode;
+}
+
+orxSTATUS ScrollBase::BaseInit()
+{
+  orxCLOCK *pstCoreClock;
+  orxSTATUS eResult;
+
+  // Binds default ScrollObject section
+  orxConfig_PushSection(szConfigSectionScrollObject);
+  orxConfig_PopSection();
+  ScrollBindObject<ScrollObject>(szConfigSectionScrollObject);
+
+  // Binds objects
+  BindObjects();
+
+  // Selects map section
+  orxConfig_SelectSection(szConfigSectionMap);
+
+  // Gets core clock
+  pstCoreClock = orxClock_Get(orxCLOCK_KZ_CORE);
+
+  // Registers update function
+  eResult = ((orxClock_Register(pstCoreClock, StaticUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL) != orxSTATUS_FAILURE)
+          && (orxClock_Register(pstCoreClock, StaticCameraUpdate, orxNULL, orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+  // Successful?
   if(eResult != orxSTATUS_FAILURE)
   {
-    // Adds event handler
-    eResult = ((orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_ANIM, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_RENDER, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_SHADER, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler) != orxSTATUS_FAILURE)
-            && (orxEvent_AddHandler(orxEVENT_TYPE_FX, StaticEventHandler) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+    // Adds event handler
+    eResult = ((orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_OBJECT, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_ANIM, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_RENDER, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_SHADER, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_FX, StaticEventHandler) != orxSTATUS_FAILURE)
+            && (orxEvent_AddHandler(orxEVENT_TYPE_CONFIG, StaticEventHandler) != orxSTATUS_FAILURE)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+    // Successful?
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      // Filters events
+      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_START), orxEVENT_KU32_MASK_ID_ALL);
+      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_GET_FLAG(orxOBJECT_EVENT_CREATE) | orxEVENT_GET_FLAG(orxOBJECT_EVENT_DELETE), orxEVENT_KU32_MASK_ID_ALL);
+      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_CONFIG, orxNULL, orxEVENT_GET_FLAG(orxCONFIG_EVENT_RELOAD_STOP), orxEVENT_KU32_MASK_ID_ALL);
+
+      // Only listens to the object events bound classes care about
+      FilterEvents();
+
+      // Clears object lists
+      orxMemory_Zero(&mstObjectList, sizeof(orxLINKLIST));
+      orxMemory_Zero(&mstObjectChronoList, sizeof(orxLINKLIST));
+
+      // Creates main viewport
+      mpstMainViewport = orxViewport_CreateFromConfig(szConfigMainViewport);
+
+      // Gets main camera
+      mpstMainCamera = orxViewport_GetCamera(mpstMainViewport);
+
+      // Sets default layer
+      SetLayerNumber(1);
+
+      // Registers commands
+      orxCOMMAND_REGISTER(szCommandCompileMap, StaticCompileMapCommand, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 2, 0, {"Map", orxCOMMAND_VAR_TYPE_STRING}, {"Output", orxCOMMAND_VAR_TYPE_STRING});
+
+      // Calls child init
+      eResult = Init();
+
+      // Successful?
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        // Updates running status
+        mbIsRunning = orxFALSE;
+
+        // Not in editor mode?
+        if(!IsEditorMode())
+        {
+          // Starts game
+          StartGame();
+        }
+      }
+    }
+    else
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+orxSTATUS ScrollBase::BaseRun()
+{
+  orxSTATUS eResult;
+
+  // Calls child run
+  eResult = Run();
+
+  // Done!
+  return eResult;
+}
+
+void ScrollBase::BaseExit()
+{
+  // Calls child exit
+  Exit();
+
+  // Clears map
+  SetMapName(orxNULL);
+
+  // Unregisters commands
+  orxCOMMAND_UNREGISTER(szCommandCompileMap);
+
+  // Disables object create handler
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_GET_FLAG(orxOBJECT_EVENT_CREATE));
+
+  // Deletes pools
+  DeletePools();
+
+  // For all objects
+  for(ScrollObject *poObject = GetNextObject(orxNULL, orxTRUE);
+      poObject;
+      poObject = GetNextObject(orxNULL, orxTRUE))
+  {
+    // Deletes it
+    DeleteObject(poObject);
+  }
+
+  // Deletes update list
+  if(mapoUpdateList)
+  {
+    orxMemory_Free(mapoUpdateList);
+    mapoUpdateList = orxNULL;
+  }
+  mu32UpdateCount = mu32UpdateSize = 0;
+
+  // Stops workers
+  StopWorkers();
+
+  // Stops streaming
+  StopStreaming();
+
+  // Deletes spatial hash
+  DeleteSpatialHash();
+
+  // Deletes journal
+  ResetJournal(0, orxFALSE);
+  if(mpstJournalTable)
+  {
+    orxHashTable_Delete(mpstJournalTable);
+    mpstJournalTable = orxNULL;
+  }
+
+  // Deletes parallel list
+  if(mastParallelList)
+  {
+    orxMemory_Free(mastParallelList);
+    mastParallelList = orxNULL;
+  }
+  mu32ParallelCount = mu32ParallelSize = 0;
+
+  // For all deferred command lists
+  for(orxU32 i = 0; i < orxTHREAD_KU32_MAX_THREAD_NUMBER; i++)
+  {
+    // Deletes it
+    if(mastDeferredList[i].astCommandList)
+    {
+      orxMemory_Free(mastDeferredList[i].astCommandList);
+    }
+    if(mastDeferredList[i].acStringBuffer)
+    {
+      orxMemory_Free(mastDeferredList[i].acStringBuffer);
+    }
+  }
+  orxMemory_Zero(mastDeferredList, sizeof(mastDeferredList));
+
+  // Removes event handler
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_ANIM, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_SHADER, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler);
+  orxEvent_RemoveHandler(orxEVENT_TYPE_CONFIG, StaticEventHandler);
+  mbEventsFiltered = orxFALSE;
+
+  // Deletes binder's table
+  ScrollObjectBinderBase::DeleteTable();
+}
+
+void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
+{
+  // Updates map streaming
+  UpdateStreaming();
+
+  // Not paused?
+  if(!mbIsPaused)
+  {
+    // Updates pooled objects' lifetimes
+    UpdatePools(_rstInfo);
+
+    // Locks object & update lists
+    mbObjectListLocked = orxTRUE;
+    mbUpdateListLocked = orxTRUE;
+
+    // For all objects registered for update, ignoring the ones created during this update
+    for(orxU32 i = 0, u32Count = mu32UpdateCount; i < u32Count; i++)
+    {
+      ScrollObject *poObject;
+
+      // Gets it
+      poObject = mapoUpdateList[i];
+
+      // Not removed during this update?
+      if(poObject)
+      {
+        orxOBJECT *pstObject;
+
+        // Gets its internal object
+        pstObject = poObject->mpstObject;
+
+        // Enabled, not paused and not pending deletion?
+        if(orxObject_IsEnabled(pstObject)
+        && !orxObject_IsPaused(pstObject)
+        && (orxObject_GetLifeTime(pstObject) != orxFLOAT_0))
+        {
+          const orxCLOCK_INFO  *pstClockInfo = orxNULL;
+          orxCLOCK             *pstClock;
+
+          // Gets its clock
+          pstClock = orxObject_GetClock(pstObject);
+
+          // Valid?
+          if(pstClock)
+          {
+            // Not paused?
+            if(!orxClock_IsPaused(pstClock))
+            {
+              // Gets its info
+              pstClockInfo = orxClock_GetInfo(pstClock);
+            }
+          }
+          else
+          {
+            // Uses core info
+            pstClockInfo = &_rstInfo;
+          }
+
+          // Should update?
+          if(pstClockInfo)
+          {
+            // Parallel?
+            if(poObject->TestFlags(ScrollObject::FlagParallel))
+            {
+              // Full?
+              if(mu32ParallelCount == mu32ParallelSize)
+              {
+                // Grows list
+                mu32ParallelSize  = mu32ParallelSize ? mu32ParallelSize << 1 : su32UpdateListSize;
+                mastParallelList  = (ParallelObject *)orxMemory_Reallocate(mastParallelList, mu32ParallelSize * sizeof(ParallelObject), orxMEMORY_TYPE_MAIN);
+                orxASSERT(mastParallelList);
+              }
+
+              // Queues it
+              mastParallelList[mu32ParallelCount].poObject      = poObject;
+              mastParallelList[mu32ParallelCount].pstClockInfo  = pstClockInfo;
+              mu32ParallelCount++;
+            }
+            else
+            {
+              // Updates object
+              poObject->Update(*pstClockInfo);
+            }
+          }
+        }
+      }
+    }
+
+    // Has parallel objects?
+    if(mu32ParallelCount)
+    {
+      // Enough of them and has workers?
+      if((mu32ParallelCount > su32ParallelChunkSize) && (StartWorkers() != orxSTATUS_FAILURE))
+      {
+        // Resets cursor
+        mu32ParallelCursor = 0;
+
+        // Wakes up workers
+        mbParallelUpdate = orxTRUE;
+        for(orxU32 i = 0; i < mu32WorkerCount; i++)
+        {
+          orxThread_SignalSemaphore(mpstWorkSemaphore);
+        }
+
+        // Takes part in the update
+        RunParallelUpdate();
+
+        // Waits for workers
+        for(orxU32 i = 0; i < mu32WorkerCount; i++)
+        {
+          orxThread_WaitSemaphore(mpstDoneSemaphore);
+        }
+        mbParallelUpdate = orxFALSE;
+
+        // Applies their deferred commands
+        ApplyDeferredCommands();
+      }
+      else
+      {
+        // For all parallel objects
+        for(orxU32 i = 0; i < mu32ParallelCount; i++)
+        {
+          // Updates it
+          mastParallelList[i].poObject->Update(*mastParallelList[i].pstClockInfo);
+        }
+      }
+
+      // Clears parallel list
+      mu32ParallelCount = 0;
+    }
+
+    // Unlocks object & update lists
+    mbUpdateListLocked = orxFALSE;
+    mbObjectListLocked = orxFALSE;
+
+    // Objects were removed during update?
+    if(mbUpdateListDirty)
+    {
+      orxU32 u32Count = 0;
+
+      // Compacts the list, keeping update order
+      for(orxU32 i = 0; i < mu32UpdateCount; i++)
+      {
+        ScrollObject *poObject;
+
+        // Gets it
+        poObject = mapoUpdateList[i];
+
+        // Valid?
+        if(poObject)
+        {
+          // Moves it
+          mapoUpdateList[u32Count] = poObject;
+          poObject->mu32UpdateIndex = u32Count++;
+        }
+      }
+
+      // Updates count
+      mu32UpdateCount   = u32Count;
+      mbUpdateListDirty = orxFALSE;
+    }
+  }
+
+  // Calls child update
+  Update(_rstInfo);
+}
+
+void ScrollBase::BaseCameraUpdate(const orxCLOCK_INFO &_rstInfo)
+{
+  // Not in editor mode?
+  if(!IsEditorMode())
+  {
+    // Calls child update
+    CameraUpdate(_rstInfo);
+  }
+}
+
+orxBOOL ScrollBase::BaseMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+{
+  orxBOOL bResult;
+
+  // Map section or game object?
+  if((!orxString_Compare(_zSectionName, szConfigSectionMap)) || (orxString_SearchString(_zSectionName, szConfigScrollObjectPrefix) == _zSectionName))
+  {
+    // Full section?
+    if(!_zKeyName)
+    {
+      // Saving journal and game object?
+      if(mbSavingJournal && orxString_Compare(_zSectionName, szConfigSectionMap))
+      {
+        // Updates result (tombstones included)
+        bResult = orxHashTable_Get(mpstJournalTable, orxString_Hash(_zSectionName)) ? orxTRUE : orxFALSE;
+      }
+      else
+      {
+        // Pushes section
+        orxConfig_PushSection(_zSectionName);
+
+        // Updates result
+        bResult = !orxConfig_GetBool(szConfigNoSave);
+
+        // Pops section
+        orxConfig_PopSection();
+      }
+    }
+    else
+    {
+      // Updates result
+      bResult = orxTRUE;
+    }
+  }
+  else
+  {
+    // Calls child method
+    bResult = MapSaveFilter(_zSectionName, _zKeyName, _zFileName, _bUseEncryption);
+
+    // Not saving yet?
+    if(!bResult)
+    {
+      // Has custom filter
+      if(mpfnCustomMapSaveFilter)
+      {
+        // Calls it
+        bResult = mpfnCustomMapSaveFilter(_zSectionName, _zKeyName, _zFileName, _bUseEncryption);
+      }
+    }
+  }
+
+  // Done!
+  return bResult;
+}
+
+orxSTRING ScrollBase::GetNewObjectName(orxCHAR _zInstanceName[32], orxBOOL _bRunTime)
+{
+  orxSTRING zResult = _zInstanceName;
+
+  // Checks
+  orxASSERT(_zInstanceName);
+
+  // Runtime?
+  if(_bRunTime)
+  {
+    // Creates name
+    orxString_NPrint(zResult, 32, szConfigScrollObjectRuntimeFormat, mu32RuntimeObjectID++);
+  }
+  else
+  {
+    // Creates name
+    orxString_NPrint(zResult, 32, szConfigScrollObjectFormat, mu32NextObjectID++);
+  }
+
+  // Done
+  return zResult;
+}
+
+void ScrollBase::AddUpdateObject(ScrollObject *_poObject)
+{
+  // Checks
+  orxASSERT(_poObject->mu32UpdateIndex == orxU32_UNDEFINED);
+
+  // Full?
+  if(mu32UpdateCount == mu32UpdateSize)
+  {
+    // Grows list
+    mu32UpdateSize  = mu32UpdateSize ? mu32UpdateSize << 1 : su32UpdateListSize;
+    mapoUpdateList  = (ScrollObject **)orxMemory_Reallocate(mapoUpdateList, mu32UpdateSize * sizeof(ScrollObject *), orxMEMORY_TYPE_MAIN);
+    orxASSERT(mapoUpdateList);
+  }
+
+  // Appends object
+  _poObject->mu32UpdateIndex        = mu32UpdateCount;
+  mapoUpdateList[mu32UpdateCount++] = _poObject;
+}
+
+void ScrollBase::RemoveUpdateObject(ScrollObject *_poObject)
+{
+  orxU32 u32Index;
+
+  // Gets its index
+  u32Index = _poObject->mu32UpdateIndex;
+
+  // Checks
+  orxASSERT((u32Index < mu32UpdateCount) && (mapoUpdateList[u32Index] == _poObject));
+
+  // Update in progress?
+  if(mbUpdateListLocked)
+  {
+    // Clears its slot, the list will get compacted at the end of the update
+    mapoUpdateList[u32Index] = orxNULL;
+    mbUpdateListDirty        = orxTRUE;
+  }
+  else
+  {
+    ScrollObject *poLastObject;
+
+    // Moves last object in its slot
+    poLastObject                  = mapoUpdateList[--mu32UpdateCount];
+    mapoUpdateList[u32Index]      = poLastObject;
+    poLastObject->mu32UpdateIndex = u32Index;
+  }
+
+  // Clears its index
+  _poObject->mu32UpdateIndex = orxU32_UNDEFINED;
+}
+
+ScrollObject *ScrollBase::CreatePooledObject(const orxSTRING _zModelName)
+{
+  ScrollObject *poResult = orxNULL;
+
+  // Is pooled?
+  if(GetPool(_zModelName))
+  {
+    // Creates or reuses object
+    poResult = CreateObject(_zModelName, ScrollObject::FlagRunTime);
+  }
+
+  // Done!
+  return poResult;
+}
+
+ScrollBase::ObjectPool *ScrollBase::GetPool(const orxSTRING _zModelName)
+{
+  ObjectPool   *pstResult;
+  orxSTRINGID   stID;
+
+  // No table yet?
+  if(!mpstPoolTable)
+  {
+    // Creates it
+    mpstPoolTable = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxASSERT(mpstPoolTable);
+  }
+
+  // Gets model ID
+  stID = orxString_Hash(_zModelName);
+
+  // Not already resolved?
+  if((pstResult = (ObjectPool *)orxHashTable_Get(mpstPoolTable, stID)) == orxNULL)
+  {
+    orxU32 u32Size;
+
+    // Gets its size, config first
+    orxConfig_PushSection(_zModelName);
+    u32Size = orxConfig_HasValue(szConfigScrollObjectPool) ? orxConfig_GetU32(szConfigScrollObjectPool) : ScrollObjectBinderBase::GetPoolSize(_zModelName);
+    orxConfig_PopSection();
+
+    // Pooled?
+    if(u32Size != 0)
+    {
+      // Full?
+      if(mu32PoolCount == mu32PoolSize)
+      {
+        // Grows pool list
+        mu32PoolSize  = mu32PoolSize ? mu32PoolSize << 1 : 16;
+        mapstPoolList = (ObjectPool **)orxMemory_Reallocate(mapstPoolList, mu32PoolSize * sizeof(ObjectPool *), orxMEMORY_TYPE_MAIN);
+        orxASSERT(mapstPoolList);
+      }
+
+      // Creates pool
+      pstResult = (ObjectPool *)orxMemory_Allocate(sizeof(ObjectPool), orxMEMORY_TYPE_MAIN);
+      orxASSERT(pstResult);
+      orxMemory_Zero(pstResult, sizeof(ObjectPool));
+      pstResult->u32Size      = u32Size;
+      pstResult->apoFreeList  = (ScrollObject **)orxMemory_Allocate(u32Size * sizeof(ScrollObject *), orxMEMORY_TYPE_MAIN);
+      orxASSERT(pstResult->apoFreeList);
+
+      // Stores it
+      mapstPoolList[mu32PoolCount++] = pstResult;
+      orxHashTable_Add(mpstPoolTable, stID, pstResult);
+    }
+    else
+    {
+      // Remembers it's not pooled
+      orxHashTable_Add(mpstPoolTable, stID, orxHANDLE_UNDEFINED);
+    }
+  }
+  else if(pstResult == (ObjectPool *)orxHANDLE_UNDEFINED)
+  {
+    // Not pooled
+    pstResult = orxNULL;
+  }
+
+  // Done!
+  return pstResult;
+}
+
+ScrollObject *ScrollBase::ReusePooledObject(const orxSTRING _zModelName, ScrollObject::Flag _xFlags, const orxSTRING _zInstanceName)
+{
+  ScrollObject *poResult = orxNULL;
+
+  // Anonymous runtime object?
+  if((_xFlags & ScrollObject::FlagRunTime) && !_zInstanceName)
+  {
+    ObjectPool *pstPool;
+
+    // Has free pooled instance?
+    if(((pstPool = GetPool(_zModelName)) != orxNULL) && (pstPool->u32FreeCount != 0))
+    {
+      orxOBJECT  *pstOrxObject;
+      orxCOLOR    stColor;
+      orxVECTOR   vScale, vPosition;
+      orxFLOAT    fLifeTime, fRotation;
+
+      // Gets it
+      poResult      = pstPool->apoFreeList[--pstPool->u32FreeCount];
+      pstOrxObject  = poResult->GetOrxObject();
+
+      // Pushes its model section
+      orxConfig_PushSection(_zModelName);
+
+      // Gets a new lifetime and its spawn state from config
+      fLifeTime = orxConfig_GetFloat(szConfigScrollObjectLifeTime);
+      fRotation = orxMATH_KF_DEG_TO_RAD * orxConfig_GetFloat(szConfigScrollObjectRotation);
+      if(!orxConfig_GetVector(szConfigScrollObjectPosition, &vPosition))
+      {
+        orxVector_Copy(&vPosition, &orxVECTOR_0);
+      }
+      if(!orxConfig_GetVector(szConfigScrollObjectScale, &vScale))
+      {
+        orxVector_SetAll(&vScale, orxConfig_HasValue(szConfigScrollObjectScale) ? orxConfig_GetFloat(szConfigScrollObjectScale) : orxFLOAT_1);
+      }
+      if(orxConfig_GetVector(szConfigScrollObjectColor, &stColor.vRGB))
+      {
+        orxVector_Mulf(&stColor.vRGB, &stColor.vRGB, orxCOLOR_NORMALIZER);
+      }
+      else
+      {
+        orxVector_Copy(&stColor.vRGB, &orxVECTOR_WHITE);
+      }
+      stColor.fAlpha = orxConfig_HasValue(szConfigScrollObjectAlpha) ? orxConfig_GetFloat(szConfigScrollObjectAlpha) : orxFLOAT_1;
+
+      // Pops config section
+      orxConfig_PopSection();
+
+      // Resets it (its GUID is kept, see CreatePooledObject())
+      poResult->mu32PoolIndex   = orxU32_UNDEFINED;
+      poResult->mfPoolLifeTime  = (fLifeTime > orxFLOAT_0) ? fLifeTime : orx2F(-1.0f);
+      orxObject_SetPosition(pstOrxObject, &vPosition);
+      orxObject_SetRotation(pstOrxObject, fRotation);
+      orxObject_SetScale(pstOrxObject, &vScale);
+      orxObject_SetColor(pstOrxObject, &stColor);
+      orxObject_SetSpeed(pstOrxObject, &orxVECTOR_0);
+      orxObject_SetAngularVelocity(pstOrxObject, orxFLOAT_0);
+      orxObject_ResetActiveTimeRecursive(pstOrxObject);
+
+      // Restarts its default anim
+      orxObject_SetTargetAnim(pstOrxObject, orxNULL);
+      orxObject_SetCurrentAnim(pstOrxObject, orxNULL);
+
+      // Refreshes it in the spatial hash
+      MarkSpatialObject(pstOrxObject);
+
+      // Re-enables it
+      orxObject_EnableRecursive(pstOrxObject, orxTRUE);
+
+      // Makes it active
+      AddPooledObject(poResult);
+
+      // Calls its recycle callback
+      poResult->OnRecycle();
+    }
+  }
+
+  // Done!
+  return poResult;
+}
+
+void ScrollBase::AddPooledObject(ScrollObject *_poObject)
+{
+  ObjectPool *pstPool;
+
+  // Is pooled?
+  if((pstPool = GetPool(_poObject->GetModelName())) != orxNULL)
+  {
+    // New instance?
+    if(!_poObject->TestFlags(ScrollObject::FlagPooled))
+    {
+      orxFLOAT fLifeTime;
 
-    // Successful?
-    if(eResult != orxSTATUS_FAILURE)
+      // Updates its flags
+      _poObject->SetFlags(ScrollObject::FlagPooled);
+
+      // Takes over its lifetime, if time-based
+      fLifeTime = orxObject_GetLifeTime(_poObject->GetOrxObject());
+      if(fLifeTime > orxFLOAT_0)
+      {
+        _poObject->mfPoolLifeTime = fLifeTime;
+        orxObject_SetLifeTime(_poObject->GetOrxObject(), orx2F(-1.0f));
+      }
+    }
+
+    // Full?
+    if(pstPool->u32ActiveCount == pstPool->u32ActiveSize)
     {
-      // Filters events
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_SYSTEM, orxNULL, orxEVENT_GET_FLAG(orxSYSTEM_EVENT_GAME_LOOP_START), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_GET_FLAG(orxOBJECT_EVENT_CREATE) | orxEVENT_GET_FLAG(orxOBJECT_EVENT_DELETE), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_ANIM, orxNULL, orxEVENT_GET_FLAG(orxANIM_EVENT_STOP) | orxEVENT_GET_FLAG(orxANIM_EVENT_CUT) | orxEVENT_GET_FLAG(orxANIM_EVENT_LOOP) | orxEVENT_GET_FLAG(orxANIM_EVENT_UPDATE) | orxEVENT_GET_FLAG(orxANIM_EVENT_CUSTOM_EVENT), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_OBJECT_START), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_SHADER, orxNULL, orxEVENT_GET_FLAG(orxSHADER_EVENT_SET_PARAM), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_PHYSICS, orxNULL, orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_ADD) | orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_REMOVE), orxEVENT_KU32_MASK_ID_ALL);
-      orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_FX, orxNULL, orxEVENT_GET_FLAG(orxFX_EVENT_START) | orxEVENT_GET_FLAG(orxFX_EVENT_STOP) | orxEVENT_GET_FLAG(orxFX_EVENT_LOOP), orxEVENT_KU32_MASK_ID_ALL);
+      // Grows active list
+      pstPool->u32ActiveSize  = pstPool->u32ActiveSize ? pstPool->u32ActiveSize << 1 : pstPool->u32Size;
+      pstPool->apoActiveList  = (ScrollObject **)orxMemory_Reallocate(pstPool->apoActiveList, pstPool->u32ActiveSize * sizeof(ScrollObject *), orxMEMORY_TYPE_MAIN);
+      orxASSERT(pstPool->apoActiveList);
+    }
 
-      // Clears object lists
-      orxMemory_Zero(&mstObjectList, sizeof(orxLINKLIST));
-      orxMemory_Zero(&mstObjectChronoList, sizeof(orxLINKLIST));
+    // Appends it
+    _poObject->mu32PoolIndex                          = pstPool->u32ActiveCount;
+    pstPool->apoActiveList[pstPool->u32ActiveCount++] = _poObject;
+  }
+}
 
-      // Creates main viewport
-      mpstMainViewport = orxViewport_CreateFromConfig(szConfigMainViewport);
+void ScrollBase::RemovePooledObject(ScrollObject *_poObject)
+{
+  ObjectPool *pstPool;
+
+  // Has pool?
+  if((mpstPoolTable != orxNULL) && ((pstPool = GetPool(_poObject->GetModelName())) != orxNULL))
+  {
+    // Active?
+    if(_poObject->mu32PoolIndex != orxU32_UNDEFINED)
+    {
+      ScrollObject *poLastObject;
+
+      // Swaps it with the last active one
+      poLastObject                                      = pstPool->apoActiveList[--pstPool->u32ActiveCount];
+      pstPool->apoActiveList[_poObject->mu32PoolIndex]  = poLastObject;
+      poLastObject->mu32PoolIndex                       = _poObject->mu32PoolIndex;
+    }
+    else
+    {
+      // For all free instances
+      for(orxU32 i = 0; i < pstPool->u32FreeCount; i++)
+      {
+        // Found?
+        if(pstPool->apoFreeList[i] == _poObject)
+        {
+          // Removes it
+          pstPool->apoFreeList[i] = pstPool->apoFreeList[--pstPool->u32FreeCount];
+          break;
+        }
+      }
+    }
+  }
+
+  // Clears its index
+  _poObject->mu32PoolIndex = orxU32_UNDEFINED;
+}
+
+orxSTATUS ScrollBase::RecycleObject(ScrollObject *_poObject)
+{
+  ObjectPool *pstPool;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  // Has room in its pool?
+  if((mpstPoolTable != orxNULL)
+  && (_poObject->mu32PoolIndex != orxU32_UNDEFINED)
+  && ((pstPool = GetPool(_poObject->GetModelName())) != orxNULL)
+  && (pstPool->u32FreeCount < pstPool->u32Size))
+  {
+    // Removes it from active list
+    RemovePooledObject(_poObject);
+
+    // Disables it
+    orxObject_EnableRecursive(_poObject->GetOrxObject(), orxFALSE);
+    _poObject->mfPoolLifeTime = orx2F(-1.0f);
+
+    // Stores it
+    pstPool->apoFreeList[pstPool->u32FreeCount++] = _poObject;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  // Done!
+  return eResult;
+}
+
+void ScrollBase::UpdatePools(const orxCLOCK_INFO &_rstInfo)
+{
+  // For all pools
+  for(orxU32 i = 0; i < mu32PoolCount; i++)
+  {
+    ObjectPool *pstPool;
+
+    // Gets it
+    pstPool = mapstPoolList[i];
+
+    // For all its active objects, backward as they might get recycled
+    for(orxU32 j = pstPool->u32ActiveCount; j-- > 0;)
+    {
+      ScrollObject *poObject;
+      orxOBJECT    *pstObject;
+
+      // Gets it
+      poObject  = pstPool->apoActiveList[j];
+      pstObject = poObject->GetOrxObject();
+
+      // Has lifetime, is enabled and not paused?
+      if((poObject->mfPoolLifeTime >= orxFLOAT_0)
+      && orxObject_IsEnabled(pstObject)
+      && !orxObject_IsPaused(pstObject))
+      {
+        orxCLOCK *pstClock;
+        orxFLOAT  fDT;
+
+        // Gets its DT
+        pstClock  = orxObject_GetClock(pstObject);
+        fDT       = pstClock ? (orxClock_IsPaused(pstClock) ? orxFLOAT_0 : orxClock_GetInfo(pstClock)->fDT) : _rstInfo.fDT;
+
+        // Expired?
+        if((poObject->mfPoolLifeTime -= fDT) <= orxFLOAT_0)
+        {
+          // Can't recycle it?
+          if(RecycleObject(poObject) == orxSTATUS_FAILURE)
+          {
+            // Lets orx delete it
+            poObject->mfPoolLifeTime = orx2F(-1.0f);
+            orxObject_SetLifeTime(pstObject, orxFLOAT_0);
+          }
+        }
+      }
+    }
+  }
+}
+
+void ScrollBase::DeletePools()
+{
+  // For all pools
+  for(orxU32 i = 0; i < mu32PoolCount; i++)
+  {
+    // Deletes it
+    if(mapstPoolList[i]->apoActiveList)
+    {
+      orxMemory_Free(mapstPoolList[i]->apoActiveList);
+    }
+    orxMemory_Free(mapstPoolList[i]->apoFreeList);
+    orxMemory_Free(mapstPoolList[i]);
+  }
+
+  // Deletes pool list & table
+  if(mapstPoolList)
+  {
+    orxMemory_Free(mapstPoolList);
+    mapstPoolList = orxNULL;
+  }
+  if(mpstPoolTable)
+  {
+    orxHashTable_Delete(mpstPoolTable);
+    mpstPoolTable = orxNULL;
+  }
+  mu32PoolCount = mu32PoolSize = 0;
+}
+
+void ScrollBase::EnableSpatialHash()
+{
+  // Not already enabled?
+  if(!mpstSpatialCellTable)
+  {
+    // Gets cell size
+    orxConfig_PushSection(szConfigSectionScroll);
+    mfSpatialCellSize = orxConfig_HasValue(szConfigSpatialCellSize) ? orxConfig_GetFloat(szConfigSpatialCellSize) : sfSpatialCellSize;
+    orxConfig_PopSection();
+
+    // Invalid?
+    if(mfSpatialCellSize <= orxFLOAT_0)
+    {
+      // Uses default one
+      mfSpatialCellSize = sfSpatialCellSize;
+    }
+
+    // Creates tables
+    mpstSpatialCellTable    = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    mpstSpatialObjectTable  = orxHashTable_Create(su32UpdateListSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxASSERT(mpstSpatialCellTable && mpstSpatialObjectTable);
+
+    // For all existing objects
+    for(orxOBJECT *pstObject = orxObject_GetNext(orxNULL, orxSTRINGID_UNDEFINED);
+        pstObject;
+        pstObject = orxObject_GetNext(pstObject, orxSTRINGID_UNDEFINED))
+    {
+      // Adds it
+      AddSpatialObject(pstObject);
+    }
+  }
+}
+
+void ScrollBase::RefreshSpatialHash()
+{
+  // New frame?
+  if(mu32SpatialStamp != mu32FrameCount)
+  {
+    orxU32 u32Count = 0;
+
+    // For all updated objects
+    for(orxU32 i = 0; i < mu32UpdateCount; i++)
+    {
+      // Valid?
+      if(mapoUpdateList[i])
+      {
+        // Marks it
+        MarkSpatialObject(mapoUpdateList[i]->GetOrxObject());
+      }
+    }
+
+    // For all objects that were moving on their own
+    for(orxU32 i = 0; i < mstSpatialDynamicList.u32Count; i++)
+    {
+      orxU64 u64GUID;
+      orxU32 u32Index;
+
+      // Gets its GUID
+      u64GUID = mstSpatialDynamicList.au64GUIDList[i];
+
+      // Still tracked?
+      if((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialObjectTable, u64GUID)) != 0)
+      {
+        SpatialEntry *pstEntry;
+
+        // Gets its entry
+        pstEntry = &mastSpatialList[u32Index - 1];
+
+        // Still moving on its own?
+        if(IsSpatialObjectDynamic(pstEntry->pstObject))
+        {
+          // Keeps it
+          mstSpatialDynamicList.au64GUIDList[u32Count++] = u64GUID;
+
+          // Marks it
+          MarkSpatialObject(pstEntry->pstObject);
+        }
+        else
+        {
+          // Updates its status
+          pstEntry->bDynamic = orxFALSE;
+        }
+      }
+    }
+
+    // Updates status
+    mstSpatialDynamicList.u32Count  = u32Count;
+    mu32SpatialStamp                = mu32FrameCount;
+  }
+
+  // For all marked objects
+  for(orxU32 i = 0; i < mstSpatialPendingList.u32Count; i++)
+  {
+    orxU64 u64GUID;
+    orxU32 u32Index;
+
+    // Gets its GUID
+    u64GUID = mstSpatialPendingList.au64GUIDList[i];
+
+    // Still tracked?
+    if((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialObjectTable, u64GUID)) != 0)
+    {
+      SpatialEntry *pstEntry;
+      orxU64        u64CellKey;
+
+      // Gets its entry
+      pstEntry            = &mastSpatialList[--u32Index];
+      pstEntry->bPending  = orxFALSE;
+
+      // Updates its position
+      orxObject_GetWorldPosition(pstEntry->pstObject, &pstEntry->vPosition);
+
+      // Gets its cell
+      u64CellKey = GetSpatialCellKey(pstEntry->vPosition);
+
+      // Changed cell?
+      if(u64CellKey != pstEntry->u64CellKey)
+      {
+        // Moves it
+        UnlinkSpatialEntry(u32Index);
+        LinkSpatialEntry(u32Index, u64CellKey);
+      }
+
+      // Moving on its own and not tracked as such yet?
+      if(!pstEntry->bDynamic && IsSpatialObjectDynamic(pstEntry->pstObject))
+      {
+        // Refreshes it every frame from now on
+        pstEntry->bDynamic = orxTRUE;
+        AddSpatialGUID(mstSpatialDynamicList, u64GUID);
+      }
+    }
+  }
+
+  // Clears marked objects
+  mstSpatialPendingList.u32Count = 0;
+}
+
+void ScrollBase::MarkSpatialObject(orxOBJECT *_pstObject)
+{
+  orxU64 u64GUID;
+  orxU32 u32Index;
+
+  // Gets its GUID
+  u64GUID = orxStructure_GetGUID(_pstObject);
+
+  // Tracked and not already marked?
+  if((mpstSpatialObjectTable != orxNULL)
+  && ((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialObjectTable, u64GUID)) != 0)
+  && !mastSpatialList[u32Index - 1].bPending)
+  {
+    // Marks it
+    mastSpatialList[u32Index - 1].bPending = orxTRUE;
+    AddSpatialGUID(mstSpatialPendingList, u64GUID);
+  }
+}
+
+void ScrollBase::GetSpatialPosition(const SpatialEntry &_rstEntry, orxVECTOR &_rvPosition)
+{
+  // Gets its current position
+  orxObject_GetWorldPosition(_rstEntry.pstObject, &_rvPosition);
+
+  // Moved without being marked (command, direct orx call)?
+  if((_rvPosition.fX != _rstEntry.vPosition.fX) || (_rvPosition.fY != _rstEntry.vPosition.fY))
+  {
+    // Marks it for the next refresh
+    MarkSpatialObject(_rstEntry.pstObject);
+  }
+}
+
+orxBOOL ScrollBase::IsSpatialObjectDynamic(orxOBJECT *_pstObject)
+{
+  orxVECTOR vSpeed;
+  orxBOOL   bResult;
+
+  // Has a body, a parent, an FX or a speed?
+  bResult = ((orxOBJECT_GET_STRUCTURE(_pstObject, BODY) != orxNULL)
+          || (orxObject_GetParent(_pstObject) != orxNULL)
+          || (orxOBJECT_GET_STRUCTURE(_pstObject, FXPOINTER) != orxNULL)
+          || ((orxObject_GetSpeed(_pstObject, &vSpeed) != orxNULL) && !orxVector_IsNull(&vSpeed)))
+          ? orxTRUE
+          : orxFALSE;
+
+  // Done!
+  return bResult;
+}
+
+void ScrollBase::AddSpatialGUID(SpatialList &_rstList, orxU64 _u64GUID)
+{
+  // Full?
+  if(_rstList.u32Count == _rstList.u32Size)
+  {
+    // Grows list
+    _rstList.u32Size      = _rstList.u32Size ? _rstList.u32Size << 1 : su32UpdateListSize;
+    _rstList.au64GUIDList = (orxU64 *)orxMemory_Reallocate(_rstList.au64GUIDList, _rstList.u32Size * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+    orxASSERT(_rstList.au64GUIDList);
+  }
+
+  // Adds GUID
+  _rstList.au64GUIDList[_rstList.u32Count++] = _u64GUID;
+}
+
+void ScrollBase::DeleteSpatialHash()
+{
+  // Deletes tables
+  if(mpstSpatialCellTable)
+  {
+    orxHashTable_Delete(mpstSpatialCellTable);
+    mpstSpatialCellTable = orxNULL;
+  }
+  if(mpstSpatialObjectTable)
+  {
+    orxHashTable_Delete(mpstSpatialObjectTable);
+    mpstSpatialObjectTable = orxNULL;
+  }
+
+  // Deletes lists
+  if(mastSpatialList)
+  {
+    orxMemory_Free(mastSpatialList);
+    mastSpatialList = orxNULL;
+  }
+  if(mafSpatialDistanceList)
+  {
+    orxMemory_Free(mafSpatialDistanceList);
+    mafSpatialDistanceList = orxNULL;
+  }
+  if(mstSpatialPendingList.au64GUIDList)
+  {
+    orxMemory_Free(mstSpatialPendingList.au64GUIDList);
+  }
+  if(mstSpatialDynamicList.au64GUIDList)
+  {
+    orxMemory_Free(mstSpatialDynamicList.au64GUIDList);
+  }
+  orxMemory_Zero(&mstSpatialPendingList, sizeof(SpatialList));
+  orxMemory_Zero(&mstSpatialDynamicList, sizeof(SpatialList));
+  mu32SpatialCount = mu32SpatialSize = mu32SpatialDistanceSize = 0;
+}
+
+void ScrollBase::AddSpatialObject(orxOBJECT *_pstObject)
+{
+  orxU64 u64GUID;
+
+  // Gets its GUID
+  u64GUID = orxStructure_GetGUID(_pstObject);
+
+  // Not already registered?
+  if(!orxHashTable_Get(mpstSpatialObjectTable, u64GUID))
+  {
+    SpatialEntry *pstEntry;
+
+    // Full?
+    if(mu32SpatialCount == mu32SpatialSize)
+    {
+      // Grows list
+      mu32SpatialSize = mu32SpatialSize ? mu32SpatialSize << 1 : su32UpdateListSize;
+      mastSpatialList = (SpatialEntry *)orxMemory_Reallocate(mastSpatialList, mu32SpatialSize * sizeof(SpatialEntry), orxMEMORY_TYPE_MAIN);
+      orxASSERT(mastSpatialList);
+    }
+
+    // Inits entry
+    pstEntry            = &mastSpatialList[mu32SpatialCount];
+    pstEntry->pstObject = _pstObject;
+    pstEntry->bPending  = orxFALSE;
+    pstEntry->bDynamic  = orxFALSE;
+    orxObject_GetWorldPosition(_pstObject, &pstEntry->vPosition);
+
+    // Registers it
+    orxHashTable_Add(mpstSpatialObjectTable, u64GUID, (void *)(orxUPTR)(mu32SpatialCount + 1));
+    LinkSpatialEntry(mu32SpatialCount, GetSpatialCellKey(pstEntry->vPosition));
+    mu32SpatialCount++;
+
+    // Its position might not be final yet
+    MarkSpatialObject(_pstObject);
+  }
+}
+
+void ScrollBase::RemoveSpatialObject(orxOBJECT *_pstObject)
+{
+  orxU64 u64GUID;
+  orxU32 u32Index;
+
+  // Gets its GUID
+  u64GUID = orxStructure_GetGUID(_pstObject);
+
+  // Registered?
+  if((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialObjectTable, u64GUID)) != 0)
+  {
+    SpatialEntry *pstEntry;
+
+    // Unregisters it
+    pstEntry = &mastSpatialList[--u32Index];
+    UnlinkSpatialEntry(u32Index);
+    orxHashTable_Remove(mpstSpatialObjectTable, u64GUID);
+
+    // Not the last one?
+    if(u32Index != --mu32SpatialCount)
+    {
+      // Moves last entry in its slot
+      orxMemory_Copy(pstEntry, &mastSpatialList[mu32SpatialCount], sizeof(SpatialEntry));
+
+      // Updates its neighbors
+      if(pstEntry->u32Previous != orxU32_UNDEFINED)
+      {
+        mastSpatialList[pstEntry->u32Previous].u32Next = u32Index;
+      }
+      else
+      {
+        orxHashTable_Set(mpstSpatialCellTable, pstEntry->u64CellKey, (void *)(orxUPTR)(u32Index + 1));
+      }
+      if(pstEntry->u32Next != orxU32_UNDEFINED)
+      {
+        mastSpatialList[pstEntry->u32Next].u32Previous = u32Index;
+      }
+
+      // Updates its registration
+      orxHashTable_Set(mpstSpatialObjectTable, orxStructure_GetGUID(pstEntry->pstObject), (void *)(orxUPTR)(u32Index + 1));
+    }
+  }
+}
+
+void ScrollBase::LinkSpatialEntry(orxU32 _u32Index, orxU64 _u64CellKey)
+{
+  SpatialEntry *pstEntry;
+  orxU32        u32Head;
+
+  // Gets entry & cell's head
+  pstEntry  = &mastSpatialList[_u32Index];
+  u32Head   = (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialCellTable, _u64CellKey);
+
+  // Inserts it at the head of the cell
+  pstEntry->u64CellKey  = _u64CellKey;
+  pstEntry->u32Previous = orxU32_UNDEFINED;
+  pstEntry->u32Next     = u32Head - 1;
+  if(u32Head != 0)
+  {
+    mastSpatialList[u32Head - 1].u32Previous = _u32Index;
+  }
+  orxHashTable_Set(mpstSpatialCellTable, _u64CellKey, (void *)(orxUPTR)(_u32Index + 1));
+}
+
+void ScrollBase::UnlinkSpatialEntry(orxU32 _u32Index)
+{
+  SpatialEntry *pstEntry;
+
+  // Gets entry
+  pstEntry = &mastSpatialList[_u32Index];
+
+  // Has previous?
+  if(pstEntry->u32Previous != orxU32_UNDEFINED)
+  {
+    // Updates it
+    mastSpatialList[pstEntry->u32Previous].u32Next = pstEntry->u32Next;
+  }
+  // Has next?
+  else if(pstEntry->u32Next != orxU32_UNDEFINED)
+  {
+    // Makes it the cell's head
+    orxHashTable_Set(mpstSpatialCellTable, pstEntry->u64CellKey, (void *)(orxUPTR)(pstEntry->u32Next + 1));
+  }
+  else
+  {
+    // Removes cell
+    orxHashTable_Remove(mpstSpatialCellTable, pstEntry->u64CellKey);
+  }
+
+  // Has next?
+  if(pstEntry->u32Next != orxU32_UNDEFINED)
+  {
+    // Updates it
+    mastSpatialList[pstEntry->u32Next].u32Previous = pstEntry->u32Previous;
+  }
+}
+
+orxU32 ScrollBase::FindSpatialObjects(const orxVECTOR &_rvMin, const orxVECTOR &_rvMax, const orxVECTOR *_pvCenter, orxFLOAT _fSquareRadius, orxOBJECT **_apstResultList, orxU32 _u32ResultSize, orxSTRINGID _stGroupID)
+{
+  orxS32  s32MinX, s32MinY, s32MaxX, s32MaxY;
+  orxBOOL bScanAll;
+  orxU32  u32Result = 0;
 
-      // Gets main camera
-      mpstMainCamera = orxViewport_GetCamera(mpstMainViewport);
+  // Checks
+  orxASSERT((_u32ResultSize == 0) || _apstResultList);
 
-      // Sets default layer
-      SetLayerNumber(1);
+  // Enables & refreshes spatial hash
+  EnableSpatialHash();
+  RefreshSpatialHash();
 
-      // Calls child init
-      eResult = Init();
+  // Gets covered cells
+  s32MinX = GetSpatialCell(_rvMin.fX);
+  s32MinY = GetSpatialCell(_rvMin.fY);
+  s32MaxX = GetSpatialCell(_rvMax.fX);
+  s32MaxY = GetSpatialCell(_rvMax.fY);
 
-      // Successful?
-      if(eResult != orxSTATUS_FAILURE)
+  // More covered cells than entries? Scans them all instead
+  bScanAll = (orxS2F(s32MaxX - s32MinX + 1) * orxS2F(s32MaxY - s32MinY + 1) > orxU2F(mu32SpatialCount)) ? orxTRUE : orxFALSE;
+  if(bScanAll)
+  {
+    s32MaxX = s32MinX;
+    s32MaxY = s32MinY;
+  }
+
+  // For all covered cells
+  for(orxS32 j = s32MinY; j <= s32MaxY; j++)
+  {
+    for(orxS32 i = s32MinX; i <= s32MaxX; i++)
+    {
+      // For all their entries
+      for(orxU32 u32Index = bScanAll ? orxMIN(mu32SpatialCount, 1u) : (orxU32)(orxUPTR)orxHashTable_Get(mpstSpatialCellTable, GetCellKey(i, j));
+          u32Index != 0;
+          u32Index = bScanAll ? ((u32Index < mu32SpatialCount) ? u32Index + 1 : 0) : mastSpatialList[u32Index - 1].u32Next + 1)
       {
-        // Updates running status
-        mbIsRunning = orxFALSE;
+        const SpatialEntry *pstEntry;
 
-        // Not in editor mode?
-        if(!IsEditorMode())
+        // Gets it
+        pstEntry = &mastSpatialList[u32Index - 1];
+
+        // Enabled and in group?
+        if(orxObject_IsEnabled(pstEntry->pstObject)
+        && ((_stGroupID == orxSTRINGID_UNDEFINED) || (orxObject_GetGroupID(pstEntry->pstObject) == _stGroupID)))
         {
-          // Starts game
-          StartGame();
+          orxVECTOR vPosition;
+
+          // Gets its position
+          GetSpatialPosition(*pstEntry, vPosition);
+
+          // Inside?
+          if((vPosition.fX >= _rvMin.fX) && (vPosition.fX <= _rvMax.fX)
+          && (vPosition.fY >= _rvMin.fY) && (vPosition.fY <= _rvMax.fY)
+          && (!_pvCenter
+           || ((vPosition.fX - _pvCenter->fX) * (vPosition.fX - _pvCenter->fX)
+             + (vPosition.fY - _pvCenter->fY) * (vPosition.fY - _pvCenter->fY) <= _fSquareRadius)))
+          {
+            // Stores it
+            if(u32Result < _u32ResultSize)
+            {
+              _apstResultList[u32Result] = pstEntry->pstObject;
+            }
+
+            // Updates result
+            u32Result++;
+          }
         }
       }
     }
-    else
-    {
-      // Updates result
-      eResult = orxSTATUS_FAILURE;
-    }
-  }
-  else
-  {
-    // Updates result
-    eResult = orxSTATUS_FAILURE;
   }
 
   // Done!
-  return eResult;
+  return u32Result;
 }
 
-orxSTATUS ScrollBase::BaseRun()
+void ScrollBase::FilterEvents()
 {
-  orxSTATUS eResult;
-
-  // Calls child run
-  eResult = Run();
+  orxU32 u32Flags;
+
+  // Gets flags of all bound classes
+  u32Flags = ScrollObjectBinderBase::su32EventFlags;
+
+  // Updates handler filters
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_ANIM, orxNULL, ((u32Flags & ScrollObject::EventFlagNewAnim) ? orxEVENT_GET_FLAG(orxANIM_EVENT_STOP) | orxEVENT_GET_FLAG(orxANIM_EVENT_CUT) | orxEVENT_GET_FLAG(orxANIM_EVENT_LOOP) : 0)
+                                                                              | ((u32Flags & ScrollObject::EventFlagAnimUpdate) ? orxEVENT_GET_FLAG(orxANIM_EVENT_UPDATE) : 0)
+                                                                              | ((u32Flags & ScrollObject::EventFlagAnimEvent) ? orxEVENT_GET_FLAG(orxANIM_EVENT_CUSTOM_EVENT) : 0), orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_RENDER, orxNULL, (u32Flags & ScrollObject::EventFlagRender) ? orxEVENT_GET_FLAG(orxRENDER_EVENT_OBJECT_START) : 0, orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_SHADER, orxNULL, (u32Flags & ScrollObject::EventFlagShader) ? orxEVENT_GET_FLAG(orxSHADER_EVENT_SET_PARAM) : 0, orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_PHYSICS, orxNULL, ((u32Flags & ScrollObject::EventFlagCollide) ? orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_ADD) : 0)
+                                                                                 | ((u32Flags & ScrollObject::EventFlagSeparate) ? orxEVENT_GET_FLAG(orxPHYSICS_EVENT_CONTACT_REMOVE) : 0), orxEVENT_KU32_MASK_ID_ALL);
+  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_FX, orxNULL, ((u32Flags & ScrollObject::EventFlagFXStart) ? orxEVENT_GET_FLAG(orxFX_EVENT_START) : 0)
+                                                                            | ((u32Flags & ScrollObject::EventFlagFXStop) ? orxEVENT_GET_FLAG(orxFX_EVENT_STOP) : 0)
+                                                                            | ((u32Flags & ScrollObject::EventFlagFXLoop) ? orxEVENT_GET_FLAG(orxFX_EVENT_LOOP) : 0), orxEVENT_KU32_MASK_ID_ALL);
+
+  // Updates status
+  mbEventsFiltered = orxTRUE;
+}
 
+orxU64 ScrollBase::GetSpatialCellKey(const orxVECTOR &_rvPosition) const
+{
   // Done!
-  return eResult;
+  return GetCellKey(GetSpatialCell(_rvPosition.fX), GetSpatialCell(_rvPosition.fY));
 }
 
-void ScrollBase::BaseExit()
+orxS32 ScrollBase::GetSpatialCell(orxFLOAT _fCoordinate) const
 {
-  // Calls child exit
-  Exit();
-
-  // Clears map
-  SetMapName(orxNULL);
-
-  // Disables object create handler
-  orxEvent_SetHandlerIDFlags(StaticEventHandler, orxEVENT_TYPE_OBJECT, orxNULL, orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_GET_FLAG(orxOBJECT_EVENT_CREATE));
+  orxFLOAT fCell;
 
-  // For all objects
-  for(ScrollObject *poObject = GetNextObject(orxNULL, orxTRUE);
-      poObject;
-      poObject = GetNextObject(orxNULL, orxTRUE))
-  {
-    // Deletes it
-    DeleteObject(poObject);
-  }
+  // Gets cell coordinate
+  fCell = orxMath_Floor(_fCoordinate / mfSpatialCellSize);
 
-  // Removes event handler
-  orxEvent_RemoveHandler(orxEVENT_TYPE_SYSTEM, StaticEventHandler);
-  orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, StaticEventHandler);
-  orxEvent_RemoveHandler(orxEVENT_TYPE_ANIM, StaticEventHandler);
-  orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, StaticEventHandler);
-  orxEvent_RemoveHandler(orxEVENT_TYPE_SHADER, StaticEventHandler);
-  orxEvent_RemoveHandler(orxEVENT_TYPE_PHYSICS, StaticEventHandler);
+  // Clamps it so that it converts safely and cell spans can't overflow (NaN maps to 0)
+  fCell = (fCell > -sfSpatialCellLimit) ? orxMIN(fCell, sfSpatialCellLimit) : (fCell <= -sfSpatialCellLimit) ? -sfSpatialCellLimit : orxFLOAT_0;
 
-  // Deletes binder's table
-  ScrollObjectBinderBase::DeleteTable();
+  // Done!
+  return orxF2S(fCell);
 }
 
-void ScrollBase::BaseUpdate(const orxCLOCK_INFO &_rstInfo)
+orxSTATUS ScrollBase::StartWorkers()
 {
-  // Not paused?
-  if(!mbIsPaused)
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Not already started?
+  if(!mpstWorkSemaphore)
   {
-    orxOBJECT *pstObject;
+    orxU32 u32WorkerNumber;
 
-    // Locks object list
-    mbObjectListLocked = orxTRUE;
+    // Pushes scroll section
+    orxConfig_PushSection(szConfigSectionScroll);
 
-    // For all enabled objects
-    for(pstObject = orxObject_GetNextEnabled(orxNULL, orxSTRINGID_UNDEFINED);
-        pstObject;
-        pstObject = orxObject_GetNextEnabled(pstObject, orxSTRINGID_UNDEFINED))
-    {
-      // Not paused and not pending deletion?
-      if(!orxObject_IsPaused(pstObject)
-      && (orxObject_GetLifeTime(pstObject) != orxFLOAT_0))
-      {
-        ScrollObject *poObject;
+    // Gets worker number
+    u32WorkerNumber = orxConfig_HasValue(szConfigThreadNumber) ? orxConfig_GetU32(szConfigThreadNumber) : orxMAX(std::thread::hardware_concurrency(), 2u) - 1;
+    u32WorkerNumber = orxMIN(u32WorkerNumber, orxTHREAD_KU32_MAX_THREAD_NUMBER);
 
-        // Gets its associated scroll object
-        poObject = (ScrollObject *)orxObject_GetUserData(pstObject);
+    // Pops config section
+    orxConfig_PopSection();
 
-        // Valid?
-        if(poObject)
-        {
-          orxCLOCK *pstClock;
+    // Creates semaphores
+    mpstWorkSemaphore = orxThread_CreateSemaphore(0);
+    mpstDoneSemaphore = orxThread_CreateSemaphore(0);
+    orxASSERT(mpstWorkSemaphore && mpstDoneSemaphore);
 
-          // Gets its clock
-          pstClock = orxObject_GetClock(pstObject);
+    // Clears stop status
+    mbStopWorkers = orxFALSE;
 
-          // Valid?
-          if(pstClock)
-          {
-            // Not paused?
-            if(!orxClock_IsPaused(pstClock))
-            {
-              // Updates object
-              poObject->Update(*orxClock_GetInfo(pstClock));
-            }
-          }
-          else
-          {
-            // Updates object
-            poObject->Update(_rstInfo);
-          }
-        }
+    // For all workers
+    for(mu32WorkerCount = 0; mu32WorkerCount < u32WorkerNumber; mu32WorkerCount++)
+    {
+      orxCHAR acName[32];
+
+      // Starts it
+      orxString_NPrint(acName, sizeof(acName), "ScrollWorker%u", mu32WorkerCount);
+      mau32WorkerList[mu32WorkerCount] = orxThread_Start(&ScrollBase::StaticWorker, acName, orxNULL);
+
+      // Failure?
+      if(mau32WorkerList[mu32WorkerCount] == orxU32_UNDEFINED)
+      {
+        // Stops here
+        break;
       }
     }
 
-    // Unlocks object list
-    mbObjectListLocked = orxFALSE;
+    // Logs message
+    orxLOG("Started %u/%u worker(s) for parallel object updates.", mu32WorkerCount, u32WorkerNumber);
   }
 
-  // Calls child update
-  Update(_rstInfo);
+  // Updates result
+  eResult = (mu32WorkerCount != 0) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+  // Done!
+  return eResult;
 }
 
-void ScrollBase::BaseCameraUpdate(const orxCLOCK_INFO &_rstInfo)
+void ScrollBase::StopWorkers()
 {
-  // Not in editor mode?
-  if(!IsEditorMode())
+  // Started?
+  if(mpstWorkSemaphore)
   {
-    // Calls child update
-    CameraUpdate(_rstInfo);
+    // Asks workers to stop
+    mbStopWorkers = orxTRUE;
+    for(orxU32 i = 0; i < mu32WorkerCount; i++)
+    {
+      orxThread_SignalSemaphore(mpstWorkSemaphore);
+    }
+
+    // Waits for them
+    for(orxU32 i = 0; i < mu32WorkerCount; i++)
+    {
+      orxThread_Join(mau32WorkerList[i]);
+    }
+    mu32WorkerCount = 0;
+
+    // Deletes semaphores
+    orxThread_DeleteSemaphore(mpstWorkSemaphore);
+    orxThread_DeleteSemaphore(mpstDoneSemaphore);
+    mpstWorkSemaphore = mpstDoneSemaphore = orxNULL;
   }
 }
 
-orxBOOL ScrollBase::BaseMapSaveFilter(const orxSTRING _zSectionName, const orxSTRING _zKeyName, const orxSTRING _zFileName, orxBOOL _bUseEncryption)
+void ScrollBase::RunParallelUpdate()
 {
-  orxBOOL bResult;
+  orxU32 u32Start;
 
-  // Map section or game object?
-  if((!orxString_Compare(_zSectionName, szConfigSectionMap)) || (orxString_SearchString(_zSectionName, szConfigScrollObjectPrefix) == _zSectionName))
+  // While there are chunks left
+  while((u32Start = mu32ParallelCursor.fetch_add(su32ParallelChunkSize)) < mu32ParallelCount)
   {
-    // Full section?
-    if(!_zKeyName)
-    {
-      // Pushes section
-      orxConfig_PushSection(_zSectionName);
+    orxU32 u32End;
 
-      // Updates result
-      bResult = !orxConfig_GetBool(szConfigNoSave);
+    // Gets chunk end
+    u32End = orxMIN(u32Start + su32ParallelChunkSize, mu32ParallelCount);
 
-      // Pops section
-      orxConfig_PopSection();
-    }
-    else
+    // For all its objects
+    for(orxU32 i = u32Start; i < u32End; i++)
     {
-      // Updates result
-      bResult = orxTRUE;
+      // Updates it
+      mastParallelList[i].poObject->Update(*mastParallelList[i].pstClockInfo);
     }
   }
-  else
+}
+
+ScrollDeferredCommand *ScrollBase::AddDeferredCommand(const ScrollObject *_poObject, ScrollDeferredCommand::Type _eType, const orxSTRING _zValue)
+{
+  ScrollDeferredCommand *pstResult = orxNULL;
+
+  // Inside a parallel update?
+  if(mbParallelUpdate)
   {
-    // Calls child method
-    bResult = MapSaveFilter(_zSectionName, _zKeyName, _zFileName, _bUseEncryption);
+    DeferredCommandList  *pstList;
+    orxU32                u32ThreadID;
 
-    // Not saving yet?
-    if(!bResult)
+    // Gets current thread ID
+    u32ThreadID = orxThread_GetCurrent();
+    orxASSERT(u32ThreadID < orxTHREAD_KU32_MAX_THREAD_NUMBER);
+
+    // Gets its list
+    pstList = &mastDeferredList[u32ThreadID];
+
+    // Full?
+    if(pstList->u32Count == pstList->u32Size)
     {
-      // Has custom filter
-      if(mpfnCustomMapSaveFilter)
+      // Grows it
+      pstList->u32Size        = pstList->u32Size ? pstList->u32Size << 1 : su32UpdateListSize;
+      pstList->astCommandList = (ScrollDeferredCommand *)orxMemory_Reallocate(pstList->astCommandList, pstList->u32Size * sizeof(ScrollDeferredCommand), orxMEMORY_TYPE_MAIN);
+      orxASSERT(pstList->astCommandList);
+    }
+
+    // Updates result
+    pstResult             = &pstList->astCommandList[pstList->u32Count++];
+    pstResult->u64GUID    = _poObject->GetGUID();
+    pstResult->eType      = _eType;
+    pstResult->bFlag      = orxFALSE;
+    pstResult->bRecursive = orxFALSE;
+
+    // Has string value?
+    if(_zValue)
+    {
+      orxU32 u32Length;
+
+      // Gets its length
+      u32Length = orxString_GetLength(_zValue) + 1;
+
+      // Not enough room?
+      if(pstList->u32StringCount + u32Length > pstList->u32StringSize)
       {
-        // Calls it
-        bResult = mpfnCustomMapSaveFilter(_zSectionName, _zKeyName, _zFileName, _bUseEncryption);
+        // Grows buffer
+        pstList->u32StringSize  = orxMAX(pstList->u32StringSize << 1, pstList->u32StringCount + u32Length);
+        pstList->acStringBuffer = (orxCHAR *)orxMemory_Reallocate(pstList->acStringBuffer, pstList->u32StringSize * sizeof(orxCHAR), orxMEMORY_TYPE_MAIN);
+        orxASSERT(pstList->acStringBuffer);
       }
+
+      // Copies it, as the caller's string might not outlive the parallel update
+      orxMemory_Copy(pstList->acStringBuffer + pstList->u32StringCount, _zValue, u32Length * sizeof(orxCHAR));
+      pstResult->u32StringOffset  = pstList->u32StringCount;
+      pstList->u32StringCount    += u32Length;
     }
   }
 
   // Done!
-  return bResult;
+  return pstResult;
 }
 
-orxSTRING ScrollBase::GetNewObjectName(orxCHAR _zInstanceName[32], orxBOOL _bRunTime)
+void ScrollBase::ApplyDeferredCommands()
 {
-  orxSTRING zResult = _zInstanceName;
+  // For all threads
+  for(orxU32 i = 0; i < orxTHREAD_KU32_MAX_THREAD_NUMBER; i++)
+  {
+    DeferredCommandList *pstList;
 
-  // Checks
-  orxASSERT(_zInstanceName);
+    // Gets its list
+    pstList = &mastDeferredList[i];
 
-  // Runtime?
-  if(_bRunTime)
-  {
-    // Creates name
-    orxString_NPrint(zResult, 32, szConfigScrollObjectRuntimeFormat, mu32RuntimeObjectID++);
-  }
-  else
-  {
-    // Creates name
-    orxString_NPrint(zResult, 32, szConfigScrollObjectFormat, mu32NextObjectID++);
-  }
+    // For all its commands
+    for(orxU32 j = 0; j < pstList->u32Count; j++)
+    {
+      const ScrollDeferredCommand  *pstCommand;
+      ScrollObject                 *poObject;
 
-  // Done
-  return zResult;
+      // Gets it
+      pstCommand = &pstList->astCommandList[j];
+
+      // Gets its object, if still alive
+      poObject = GetObject(pstCommand->u64GUID);
+
+      // Valid?
+      if(poObject)
+      {
+        // Depending on type
+        switch(pstCommand->eType)
+        {
+          case ScrollDeferredCommand::TypePosition:
+          {
+            poObject->SetPosition(pstCommand->vValue, pstCommand->bFlag);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeRotation:
+          {
+            poObject->SetRotation(pstCommand->fValue, pstCommand->bFlag);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeScale:
+          {
+            poObject->SetScale(pstCommand->vValue, pstCommand->bFlag);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeSpeed:
+          {
+            poObject->SetSpeed(pstCommand->vValue, pstCommand->bFlag);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeColor:
+          {
+            poObject->SetColor(pstCommand->stColor, pstCommand->bRecursive);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeAnim:
+          {
+            poObject->SetAnim(pstList->acStringBuffer + pstCommand->u32StringOffset, pstCommand->bFlag, pstCommand->bRecursive);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeFX:
+          {
+            poObject->AddFX(pstList->acStringBuffer + pstCommand->u32StringOffset, pstCommand->bRecursive);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeLifeTime:
+          {
+            poObject->SetLifeTime(pstCommand->fValue);
+            break;
+          }
+
+          case ScrollDeferredCommand::TypeCommand:
+          {
+            orxCOMMAND_VAR stResult;
+
+            // Evaluates it on behalf of the object
+            orxCommand_EvaluateWithGUID(pstList->acStringBuffer + pstCommand->u32StringOffset, pstCommand->u64GUID, &stResult);
+            break;
+          }
+
+          default:
+          {
+            // Should not happen
+            orxASSERT(orxFALSE);
+            break;
+          }
+        }
+      }
+    }
+
+    // Clears list
+    pstList->u32Count       = 0;
+    pstList->u32StringCount = 0;
+  }
 }
 
 void ScrollBase::DeleteInstance()
@@ -1997,6 +5189,14 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       break;
     }
 
+    // Config event
+    case orxEVENT_TYPE_CONFIG:
+    {
+      // Sections may have changed their parents: invalidates resolved binders
+      ScrollObjectBinderBase::ClearCache();
+      break;
+    }
+
     // Object event
     case orxEVENT_TYPE_OBJECT:
     {
@@ -2008,6 +5208,20 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       // Gets object
       pstObject = orxOBJECT(_pstEvent->hSender);
 
+      // Spatial hash enabled?
+      if(roGame.mpstSpatialCellTable)
+      {
+        // Updates it
+        if(_pstEvent->eID == orxOBJECT_EVENT_CREATE)
+        {
+          roGame.AddSpatialObject(pstObject);
+        }
+        else
+        {
+          roGame.RemoveSpatialObject(pstObject);
+        }
+      }
+
       // Create?
       if(_pstEvent->eID == orxOBJECT_EVENT_CREATE)
       {
@@ -2022,11 +5236,10 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
           // Found?
           if(poBinder)
           {
-            orxCHAR       zInstanceName[32];
             ScrollObject *poObject;
 
-            // Uses it
-            poObject = poBinder->CreateObject(pstObject, roGame.GetNewObjectName(zInstanceName, orxTRUE), ScrollObject::FlagRunTime);
+            // Uses it (named on demand)
+            poObject = poBinder->CreateObject(pstObject, orxNULL, ScrollObject::FlagRunTime);
 
             // Valid?
             if(poObject)
@@ -2083,6 +5296,7 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
     {
       orxPHYSICS_EVENT_PAYLOAD *pstPayload;
       ScrollObject             *poSender, *poRecipient;
+      orxU32                    u32EventFlag;
 
       // Gets payload
       pstPayload = (orxPHYSICS_EVENT_PAYLOAD *)_pstEvent->pstPayload;
@@ -2091,8 +5305,11 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       poSender    = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hSender));
       poRecipient = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hRecipient));
 
-      // Is sender valid?
-      if(poSender)
+      // Gets event of interest
+      u32EventFlag = (_pstEvent->eID == orxPHYSICS_EVENT_CONTACT_ADD) ? ScrollObject::EventFlagCollide : ScrollObject::EventFlagSeparate;
+
+      // Is sender valid and interested?
+      if(poSender && (poSender->mu32EventFlags & u32EventFlag))
       {
         orxVECTOR vNormal;
 
@@ -2112,8 +5329,14 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
         }
       }
 
-      // Is recipient valid?
-      if(poRecipient)
+      else if(poSender)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
+
+      // Is recipient valid and interested?
+      if(poRecipient && (poRecipient->mu32EventFlags & u32EventFlag))
       {
         // New collision?
         if(_pstEvent->eID == orxPHYSICS_EVENT_CONTACT_ADD)
@@ -2127,6 +5350,11 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
           poRecipient->OnSeparate(poSender, pstPayload->pstRecipientPart, pstPayload->pstSenderPart);
         }
       }
+      else if(poRecipient)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
       break;
     }
 
@@ -2134,12 +5362,16 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
     case orxEVENT_TYPE_ANIM:
     {
       ScrollObject *poSender;
+      orxU32        u32EventFlag;
 
       // Gets sender object
       poSender = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hSender));
 
-      // Valid?
-      if(poSender)
+      // Gets event of interest
+      u32EventFlag = (_pstEvent->eID == orxANIM_EVENT_UPDATE) ? ScrollObject::EventFlagAnimUpdate : (_pstEvent->eID == orxANIM_EVENT_CUSTOM_EVENT) ? ScrollObject::EventFlagAnimEvent : ScrollObject::EventFlagNewAnim;
+
+      // Valid and interested?
+      if(poSender && (poSender->mu32EventFlags & u32EventFlag))
       {
         orxANIM_EVENT_PAYLOAD *pstPayload;
 
@@ -2213,6 +5445,11 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
           }
         }
       }
+      else if(poSender)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
       break;
     }
 
@@ -2220,12 +5457,16 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
     case orxEVENT_TYPE_FX:
     {
       ScrollObject *poSender;
+      orxU32        u32EventFlag;
 
       // Gets sender object
       poSender = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hSender));
 
-      // Valid?
-      if(poSender)
+      // Gets event of interest
+      u32EventFlag = (_pstEvent->eID == orxFX_EVENT_START) ? ScrollObject::EventFlagFXStart : (_pstEvent->eID == orxFX_EVENT_STOP) ? ScrollObject::EventFlagFXStop : ScrollObject::EventFlagFXLoop;
+
+      // Valid and interested?
+      if(poSender && (poSender->mu32EventFlags & u32EventFlag))
       {
         orxFX_EVENT_PAYLOAD *pstPayload;
 
@@ -2267,6 +5508,11 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
           }
         }
       }
+      else if(poSender)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
 
       break;
     }
@@ -2279,12 +5525,17 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       // Gets sender object
       poSender = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hSender));
 
-      // Valid?
-      if(poSender)
+      // Valid and interested?
+      if(poSender && (poSender->mu32EventFlags & ScrollObject::EventFlagRender))
       {
         // Calls object callback
         eResult = poSender->OnRender(*(orxRENDER_EVENT_PAYLOAD *)_pstEvent->pstPayload) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
       }
+      else if(poSender)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
       break;
     }
 
@@ -2296,12 +5547,17 @@ orxSTATUS orxFASTCALL ScrollBase::StaticEventHandler(const orxEVENT *_pstEvent)
       // Gets sender object
       poSender = (ScrollObject *)orxObject_GetUserData(orxOBJECT(_pstEvent->hSender));
 
-      // Valid?
-      if(poSender)
+      // Valid and interested?
+      if(poSender && (poSender->mu32EventFlags & ScrollObject::EventFlagShader))
       {
         // Calls object callback
         eResult = poSender->OnShader(*(orxSHADER_EVENT_PAYLOAD *)_pstEvent->pstPayload) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
       }
+      else if(poSender)
+      {
+        // Updates skipped count
+        ScrollBase::GetInstance().mu32SkippedEventCount++;
+      }
       break;
     }
 
@@ -2325,17 +5581,270 @@ orxSTATUS orxFASTCALL ScrollBase::StaticBootstrap()
   return roGame.Bootstrap();
 }
 
+orxSTATUS orxFASTCALL ScrollBase::StaticWorker(void *_pContext)
+{
+  orxSTATUS   eResult;
+  ScrollBase &roGame = GetInstance();
+
+  // Waits for work
+  orxThread_WaitSemaphore(roGame.mpstWorkSemaphore);
+
+  // Should stop?
+  if(roGame.mbStopWorkers)
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+  else
+  {
+    // Takes part in the update
+    roGame.RunParallelUpdate();
+
+    // Notifies main thread
+    orxThread_SignalSemaphore(roGame.mpstDoneSemaphore);
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  // Done!
+  return eResult;
+}
+
+void orxFASTCALL ScrollBase::StaticCompileMapCommand(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  ScrollBase &roGame = GetInstance();
+
+  // Compiles map
+  _pstResult->bValue = (roGame.CompileMap(_astArgList[0].zValue, _astArgList[1].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+}
+
+
+//! Object code depending on ScrollBase
+const orxSTRING ScrollObject::GetName() const
+{
+  // Has pending runtime name?
+  if(mu32RuntimeID != orxU32_UNDEFINED)
+  {
+    // Generates it
+    orxString_NPrint(macName, sizeof(macName), ScrollBase::szConfigScrollObjectRuntimeFormat, mu32RuntimeID);
+    mu32RuntimeID = orxU32_UNDEFINED;
+  }
+
+  // Done!
+  return macName;
+}
+
+void ScrollObject::SetPosition(const orxVECTOR &_rvPosition, orxBOOL _bWorld)
+{
+  // Local?
+  if(!_bWorld)
+  {
+    // Updates its position
+    orxObject_SetPosition(mpstObject, &_rvPosition);
+  }
+  else
+  {
+    // Updates its position
+    orxObject_SetWorldPosition(mpstObject, &_rvPosition);
+  }
+
+  // Marks it as modified
+  SetFlags(FlagDirty);
+
+  // Refreshes it in the spatial hash
+  ScrollBase::GetInstance().MarkSpatialObject(mpstObject);
+}
+
+void ScrollObject::SetSpeed(const orxVECTOR &_rvSpeed, orxBOOL _bRelative)
+{
+  // Relative?
+  if(_bRelative)
+  {
+    // Updates its speed
+    orxObject_SetRelativeSpeed(mpstObject, &_rvSpeed);
+  }
+  else
+  {
+    // Updates its speed
+    orxObject_SetSpeed(mpstObject, &_rvSpeed);
+  }
+
+  // Refreshes it in the spatial hash
+  ScrollBase::GetInstance().MarkSpatialObject(mpstObject);
+}
+
+
+//! Deferred commands
+void ScrollObject::DeferPosition(const orxVECTOR &_rvPosition, orxBOOL _bWorld)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypePosition)))
+  {
+    // Stores its parameters
+    orxVector_Copy(&pstCommand->vValue, &_rvPosition);
+    pstCommand->bFlag = _bWorld;
+  }
+  else
+  {
+    // Applies it
+    SetPosition(_rvPosition, _bWorld);
+  }
+}
+
+void ScrollObject::DeferRotation(orxFLOAT _fRotation, orxBOOL _bWorld)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeRotation)))
+  {
+    // Stores its parameters
+    pstCommand->fValue  = _fRotation;
+    pstCommand->bFlag   = _bWorld;
+  }
+  else
+  {
+    // Applies it
+    SetRotation(_fRotation, _bWorld);
+  }
+}
+
+void ScrollObject::DeferScale(const orxVECTOR &_rvScale, orxBOOL _bWorld)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeScale)))
+  {
+    // Stores its parameters
+    orxVector_Copy(&pstCommand->vValue, &_rvScale);
+    pstCommand->bFlag = _bWorld;
+  }
+  else
+  {
+    // Applies it
+    SetScale(_rvScale, _bWorld);
+  }
+}
+
+void ScrollObject::DeferSpeed(const orxVECTOR &_rvSpeed, orxBOOL _bRelative)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeSpeed)))
+  {
+    // Stores its parameters
+    orxVector_Copy(&pstCommand->vValue, &_rvSpeed);
+    pstCommand->bFlag = _bRelative;
+  }
+  else
+  {
+    // Applies it
+    SetSpeed(_rvSpeed, _bRelative);
+  }
+}
+
+void ScrollObject::DeferColor(const orxCOLOR &_rstColor, orxBOOL _bRecursive)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeColor)))
+  {
+    // Stores its parameters
+    pstCommand->stColor     = _rstColor;
+    pstCommand->bRecursive  = _bRecursive;
+  }
+  else
+  {
+    // Applies it
+    SetColor(_rstColor, _bRecursive);
+  }
+}
+
+void ScrollObject::DeferAnim(const orxSTRING _zAnim, orxBOOL _bCurrent, orxBOOL _bRecursive)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeAnim, _zAnim)))
+  {
+    // Stores its parameters
+    pstCommand->bFlag       = _bCurrent;
+    pstCommand->bRecursive  = _bRecursive;
+  }
+  else
+  {
+    // Applies it
+    SetAnim(_zAnim, _bCurrent, _bRecursive);
+  }
+}
+
+void ScrollObject::DeferFX(const orxSTRING _zFXName, orxBOOL _bRecursive)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeFX, _zFXName)))
+  {
+    // Stores its parameters
+    pstCommand->bRecursive  = _bRecursive;
+  }
+  else
+  {
+    // Applies it
+    AddFX(_zFXName, _bRecursive);
+  }
+}
+
+void ScrollObject::DeferLifeTime(orxFLOAT _fLifeTime)
+{
+  ScrollDeferredCommand *pstCommand;
+
+  // Queued?
+  if((pstCommand = ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeLifeTime)))
+  {
+    // Stores its parameters
+    pstCommand->fValue = _fLifeTime;
+  }
+  else
+  {
+    // Applies it
+    SetLifeTime(_fLifeTime);
+  }
+}
+
+void ScrollObject::DeferCommand(const orxSTRING _zCommand)
+{
+  // Not queued?
+  if(!ScrollBase::GetInstance().AddDeferredCommand(this, ScrollDeferredCommand::TypeCommand, _zCommand))
+  {
+    orxCOMMAND_VAR stResult;
+
+    // Applies it
+    orxCommand_EvaluateWithGUID(_zCommand, GetGUID(), &stResult);
+  }
+}
+
 
 //! Binder classes
 
 //! Constants
 
 // Misc
-const orxU32            ScrollObjectBinderBase::su32TableSize     = 64;
+const orxU32            ScrollObjectBinderBase::su32TableSize       = 64;
+const orxU32            ScrollObjectBinderBase::su32CacheTableSize  = 256;
 
 
 //! Static variables
-orxHASHTABLE *          ScrollObjectBinderBase::spstTable         = orxNULL;
+orxHASHTABLE *          ScrollObjectBinderBase::spstTable           = orxNULL;
+orxHASHTABLE *          ScrollObjectBinderBase::spstCacheTable      = orxNULL;
+orxHASHTABLE *          ScrollObjectBinderBase::spstPoolSizeTable   = orxNULL;
+orxU32                  ScrollObjectBinderBase::su32EventFlags      = 0;
 
 
 //! Code
@@ -2379,6 +5888,65 @@ void ScrollObjectBinderBase::DeleteTable()
   // Deletes binder table
   orxHashTable_Delete(spstTable);
   spstTable = orxNULL;
+
+  // Deletes cache table
+  if(spstCacheTable)
+  {
+    orxHashTable_Delete(spstCacheTable);
+    spstCacheTable = orxNULL;
+  }
+
+  // Deletes pool size table
+  if(spstPoolSizeTable)
+  {
+    orxHashTable_Delete(spstPoolSizeTable);
+    spstPoolSizeTable = orxNULL;
+  }
+
+  // Clears event flags
+  su32EventFlags = 0;
+}
+
+void ScrollObjectBinderBase::SetPoolSize(const orxSTRING _zName, orxU32 _u32PoolSize)
+{
+  // No table yet?
+  if(!spstPoolSizeTable)
+  {
+    // Creates it
+    spstPoolSizeTable = orxHashTable_Create(su32TableSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+  }
+
+  // Stores size
+  orxHashTable_Set(spstPoolSizeTable, orxString_Hash(_zName), (void *)(orxUPTR)_u32PoolSize);
+}
+
+orxU32 ScrollObjectBinderBase::GetPoolSize(const orxSTRING _zName)
+{
+  orxU32 u32Result = 0;
+
+  // Has pools?
+  if(spstPoolSizeTable)
+  {
+    const orxSTRING zSection;
+
+    // Gets registered size, using config hierarchy
+    for(zSection = _zName;
+        zSection && ((u32Result = (orxU32)(orxUPTR)orxHashTable_Get(spstPoolSizeTable, orxString_Hash(zSection))) == 0);
+        zSection = orxConfig_GetParent(zSection));
+  }
+
+  // Done!
+  return u32Result;
+}
+
+void ScrollObjectBinderBase::ClearCache()
+{
+  // Has cache?
+  if(spstCacheTable)
+  {
+    // Clears it
+    orxHashTable_Clear(spstCacheTable);
+  }
 }
 
 ScrollObjectBinderBase *ScrollObjectBinderBase::GetDefaultBinder()
@@ -2394,12 +5962,37 @@ ScrollObjectBinderBase *ScrollObjectBinderBase::GetBinder(const orxSTRING _zName
   // Valid name?
   if(_zName && (_zName != orxSTRING_EMPTY))
   {
-    const orxSTRING zSection;
+    orxSTRINGID stID;
+    void       *pCached;
+
+    // Gets section ID
+    stID = orxString_Hash(_zName);
+
+    // No cache yet?
+    if(!spstCacheTable)
+    {
+      // Creates it
+      spstCacheTable = orxHashTable_Create(su32CacheTableSize, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    }
 
-    // Gets associated binder, using config hierarchy
-    for(zSection = _zName, poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection));
-        (!poResult) && ((zSection = orxConfig_GetParent(zSection)));
-        poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection)));
+    // Already resolved?
+    if((pCached = orxHashTable_Get(spstCacheTable, stID)) != orxNULL)
+    {
+      // Updates result (undefined when no binder was found)
+      poResult = (pCached != orxHANDLE_UNDEFINED) ? (ScrollObjectBinderBase *)pCached : orxNULL;
+    }
+    else
+    {
+      const orxSTRING zSection;
+
+      // Gets associated binder, using config hierarchy
+      for(zSection = _zName, poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), stID);
+          (!poResult) && ((zSection = orxConfig_GetParent(zSection)));
+          poResult = (ScrollObjectBinderBase *)orxHashTable_Get(GetTable(), orxString_Hash(zSection)));
+
+      // Caches it
+      orxHashTable_Add(spstCacheTable, stID, poResult ? (void *)poResult : (void *)orxHANDLE_UNDEFINED);
+    }
   }
 
   // Not found and default allowed?
@@ -2413,13 +6006,35 @@ ScrollObjectBinderBase *ScrollObjectBinderBase::GetBinder(const orxSTRING _zName
   return poResult;
 }
 
-ScrollObjectBinderBase::ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u32ElementSize)
+ScrollObjectBinderBase::ScrollObjectBinderBase(orxS32 _s32SegmentSize, orxU32 _u32ElementSize, orxBOOL _bUpdate, orxU32 _u32EventFlags)
 {
   // Creates bank
   mpstBank = orxBank_Create((orxU32)_s32SegmentSize, _u32ElementSize, orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
   // Clears variables
   mpoFirstObject = mpoLastObject = orxNULL;
+  mapoObjectList = orxNULL;
+  mu32ObjectCount = mu32ObjectSize = 0;
+
+  // Stores update status
+  mbUpdate = _bUpdate;
+
+  // Stores event flags
+  mu32EventFlags = _u32EventFlags;
+
+  // New events of interest?
+  if((su32EventFlags | _u32EventFlags) != su32EventFlags)
+  {
+    // Updates them
+    su32EventFlags |= _u32EventFlags;
+
+    // Bound after init?
+    if(ScrollBase::spoInstance && ScrollBase::spoInstance->mbEventsFiltered)
+    {
+      // Updates game's filters
+      ScrollBase::spoInstance->FilterEvents();
+    }
+  }
 }
 
 ScrollObjectBinderBase::~ScrollObjectBinderBase()
@@ -2427,6 +6042,14 @@ ScrollObjectBinderBase::~ScrollObjectBinderBase()
   // Deletes bank
   orxBank_Delete(mpstBank);
   mpstBank = orxNULL;
+
+  // Deletes object list
+  if(mapoObjectList)
+  {
+    orxMemory_Free(mapoObjectList);
+    mapoObjectList = orxNULL;
+  }
+  mu32ObjectCount = mu32ObjectSize = 0;
 }
 
 ScrollObject *ScrollObjectBinderBase::CreateObject(const orxSTRING _zModelName, const orxSTRING _zInstanceName, ScrollObject::Flag _xFlags)
@@ -2493,19 +6116,44 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
         // Stores it
         mpoLastObject = poResult;
       }
+
+      // Adds it to the packed list
+      AddIndexedObject(poResult);
     }
 
     // Adds to chronological list
     orxLinkList_AddEnd(&roGame.mstObjectChronoList, &poResult->mstChronoNode);
 
+    // Overrides update?
+    if(mbUpdate)
+    {
+      // Adds it to the update list
+      roGame.AddUpdateObject(poResult);
+    }
+
+    // Stores events of interest
+    poResult->mu32EventFlags = mu32EventFlags;
+
     // Stores internal object
     poResult->SetOrxObject(_pstOrxObject);
 
     // Sets object as user data
     orxObject_SetUserData(_pstOrxObject, poResult);
 
-    // Stores its name
-    orxString_NPrint(poResult->macName, sizeof(poResult->macName), "%s", _zInstanceName);
+    // Has instance name?
+    if(_zInstanceName)
+    {
+      // Stores it
+      orxString_NPrint(poResult->macName, sizeof(poResult->macName), "%s", _zInstanceName);
+    }
+    else
+    {
+      // Checks
+      orxASSERT(_xFlags & ScrollObject::FlagRunTime);
+
+      // Reserves a runtime ID, its name will only be generated when needed
+      poResult->mu32RuntimeID = roGame.mu32RuntimeObjectID++;
+    }
 
     // Inits flags
     xFlags = _xFlags;
@@ -2556,6 +6204,13 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
       xFlags |= ScrollObject::FlagPausable;
     }
 
+    // Is parallel-safe?
+    if(orxConfig_GetBool(ScrollBase::szConfigScrollObjectParallelUpdate))
+    {
+      // Updates flags
+      xFlags |= ScrollObject::FlagParallel;
+    }
+
     // Stores flags
     poResult->SetFlags(xFlags, ScrollObject::MaskAll);
 
@@ -2575,6 +6230,13 @@ ScrollObject *ScrollObjectBinderBase::CreateObject(orxOBJECT *_pstOrxObject, con
 
     // Pops section
     poResult->PopConfigSection();
+
+    // Anonymous runtime object?
+    if((_xFlags & ScrollObject::FlagRunTime) && !_zInstanceName)
+    {
+      // Adds it to its pool, if any
+      roGame.AddPooledObject(poResult);
+    }
   }
   else
   {
@@ -2633,8 +6295,8 @@ void ScrollObjectBinderBase::DeleteObject(ScrollObject *_poObject, const orxSTRI
     roGame.mbObjectListLocked = bObjectListBlockBackup;
   }
 
-  // Gets its name
-  zName = _poObject->GetName();
+  // Gets its name, if it was ever generated
+  zName = (_poObject->mu32RuntimeID == orxU32_UNDEFINED) ? _poObject->GetName() : orxNULL;
 
   // Valid?
   if(zName && (zName[0] != orxCHAR_NULL))
@@ -2649,6 +6311,16 @@ void ScrollObjectBinderBase::DeleteObject(ScrollObject *_poObject, const orxSTRI
     // Clears it
     orxConfig_ClearSection(zName);
     orxASSERT(!orxConfig_HasSection(zName));
+
+    // Savable with a valid map journal?
+    if(_poObject->TestFlags(ScrollObject::FlagSave) && roGame.mbJournalValid)
+    {
+      // Leaves a tombstone for the next journal save
+      orxConfig_PushSection(zName);
+      orxConfig_SetBool(ScrollBase::szConfigNoSave, orxTRUE);
+      orxConfig_PopSection();
+      roGame.AddJournalSection(zName);
+    }
   }
 
   // Removes object as user data
@@ -2690,6 +6362,9 @@ void ScrollObjectBinderBase::DeleteObject(ScrollObject *_poObject, const orxSTRI
 
     // Removes it from chronological list
     orxLinkList_Remove(&_poObject->mstNode);
+
+    // Removes it from the packed list
+    RemoveIndexedObject(_poObject);
   }
 
   // Checks
@@ -2698,6 +6373,20 @@ void ScrollObjectBinderBase::DeleteObject(ScrollObject *_poObject, const orxSTRI
   // Removes it from chronological list
   orxLinkList_Remove(&_poObject->mstChronoNode);
 
+  // In update list?
+  if(_poObject->mu32UpdateIndex != orxU32_UNDEFINED)
+  {
+    // Removes it
+    roGame.RemoveUpdateObject(_poObject);
+  }
+
+  // Pooled?
+  if(_poObject->TestFlags(ScrollObject::FlagPooled))
+  {
+    // Removes it from its pool
+    roGame.RemovePooledObject(_poObject);
+  }
+
   // Deletes it
   DestructObject(_poObject);
 }
@@ -2761,6 +6450,55 @@ ScrollObject *ScrollObjectBinderBase::GetPreviousObject(const ScrollObject *_poO
   return poResult;
 }
 
+orxU32 ScrollObjectBinderBase::GetObjectCount() const
+{
+  // Done!
+  return mu32ObjectCount;
+}
+
+ScrollObject *ScrollObjectBinderBase::GetObjectAt(orxU32 _u32Index) const
+{
+  // Done!
+  return (_u32Index < mu32ObjectCount) ? mapoObjectList[_u32Index] : (ScrollObject *)orxNULL;
+}
+
+void ScrollObjectBinderBase::AddIndexedObject(ScrollObject *_poObject)
+{
+  // Checks
+  orxASSERT(_poObject->mu32BinderIndex == orxU32_UNDEFINED);
+
+  // Full?
+  if(mu32ObjectCount == mu32ObjectSize)
+  {
+    // Grows list
+    mu32ObjectSize  = mu32ObjectSize ? mu32ObjectSize << 1 : ScrollBase::su32UpdateListSize;
+    mapoObjectList  = (ScrollObject **)orxMemory_Reallocate(mapoObjectList, mu32ObjectSize * sizeof(ScrollObject *), orxMEMORY_TYPE_MAIN);
+    orxASSERT(mapoObjectList);
+  }
+
+  // Adds object
+  _poObject->mu32BinderIndex        = mu32ObjectCount;
+  mapoObjectList[mu32ObjectCount++] = _poObject;
+}
+
+void ScrollObjectBinderBase::RemoveIndexedObject(ScrollObject *_poObject)
+{
+  orxU32 u32Index;
+
+  // Gets its index
+  u32Index = _poObject->mu32BinderIndex;
+
+  // Checks
+  orxASSERT((u32Index < mu32ObjectCount) && (mapoObjectList[u32Index] == _poObject));
+
+  // Moves last object in its slot
+  mapoObjectList[u32Index]                    = mapoObjectList[--mu32ObjectCount];
+  mapoObjectList[u32Index]->mu32BinderIndex   = u32Index;
+
+  // Clears its index
+  _poObject->mu32BinderIndex = orxU32_UNDEFINED;
+}
+
 #ifdef __orxLLVM__
   #pragma clang diagnostic pop
 #endif // __orxLLVM__
@@ -103,6 +103,13 @@ private:
 
                 void            SetSelection(ScrollObject *_poObject = orxNULL);
                 orxOBJECT *     PickObject(const orxVECTOR &_rvPos, orxSTRINGID _stGroupID = orxSTRINGID_UNDEFINED) const;
+                orxOBJECT *     PickOwnedObject(orxOBJECT *_pstObject, const orxVECTOR &_rvPos, orxSTRINGID _stGroupID, orxFLOAT &_rfDepth) const;
+                void            UpdatePickGrid();
+                void            UpdatePickObject(const ScrollObject *_poObject);
+                void            RemovePickObject(orxU64 _u64GUID);
+                void            ClearPickGrid();
+                void            UpdatePickCells(orxU64 _u64GUID, const orxAABOX &_rstBox, orxBOOL _bAdd);
+                orxBOOL         GetPickBox(const orxOBJECT *_pstObject, orxAABOX &_rstBox) const;
                 ScrollObject *  AddObject(const ScrollObject *_poModel = orxNULL);
                 void            RemoveObject(ScrollObject *_poObject);
 
@@ -152,6 +159,19 @@ private:
 
                 ButtonData *    GetActiveButton(const orxSTRING _zAction) const;
 
+  struct PickEntry
+  {
+    orxU64            mu64GUID;
+    orxAABOX          mstBox;
+  };
+
+  struct PickCell
+  {
+    orxU64           *mau64ObjectList;
+    orxU32            mu32Count;
+    orxU32            mu32Size;
+  };
+
 
   static  const orxSTRING       szMapShortParam;
   static  const orxSTRING       szMapLongParam;
@@ -211,6 +231,7 @@ private:
   static  const orxSTRING       szConfigLoseFocusFX;
   static  const orxSTRING       szConfigRotationSnap;
   static  const orxSTRING       szConfigGridSize;
+  static  const orxSTRING       szConfigPickCellSize;
   static  const orxSTRING       szConfigNameText;
   static  const orxSTRING       szConfigLayerText;
   static  const orxSTRING       szConfigPropertyText;
@@ -242,6 +263,9 @@ private:
   static  const orxSTRING       szConfigShaderColor;
   static  const orxSTRING       szConfigShaderTime;
 
+  static  const orxU32          su32PickCellMaxNumber;
+  static  const orxFLOAT        sfPickCellSize;
+
 
 //! Variables
 private:
@@ -263,14 +287,23 @@ private:
                 ScrollObject *  mpoCursorObject;
                 ScrollObject *  mpoSelection;
                 ButtonData *    mpstButtonHighlight;
+                PickEntry *     mastPickList;
+                orxHASHTABLE *  mpstPickObjectTable;
+                orxHASHTABLE *  mpstPickCellTable;
+                orxBANK *       mpstPickCellBank;
+                PickCell        mstPickLargeCell;
                 orxSTRING       mzMapName;
                 orxFLOAT        mfLocalTime;
                 orxFLOAT        mfAutoSaveInterval;
                 orxFLOAT        mfAutoSaveTimeStamp;
                 orxFLOAT        mfZoom;
                 orxFLOAT        mfWorkRotation;
+                orxFLOAT        mfPickCellSize;
                 orxU32          mu32LayerIndex;
                 orxU32          mu32CursorObjectIndex;
+                orxU32          mu32PickCount;
+                orxU32          mu32PickSize;
+                orxBOOL         mbPickGridDirty;
                 Flag            mxFlags;
 
   static        ScrollEd *      spoInstance;
@@ -342,6 +375,7 @@ const orxSTRING ScrollEd::szConfigGainFocusFX       = "GainFocusFX";
 const orxSTRING ScrollEd::szConfigLoseFocusFX       = "LoseFocusFX";
 const orxSTRING ScrollEd::szConfigRotationSnap      = "RotationSnap";
 const orxSTRING ScrollEd::szConfigGridSize          = "GridSize";
+const orxSTRING ScrollEd::szConfigPickCellSize      = "PickCellSize";
 const orxSTRING ScrollEd::szConfigNameText          = "NameText";
 const orxSTRING ScrollEd::szConfigLayerText         = "LayerText";
 const orxSTRING ScrollEd::szConfigPropertyText      = "PropertyText";
@@ -379,6 +413,9 @@ const orxSTRING ScrollEd::szConfigShaderCameraZoom  = "camerazoom";
 const orxSTRING ScrollEd::szConfigShaderColor       = "color";
 const orxSTRING ScrollEd::szConfigShaderTime        = "time";
 
+const orxU32    ScrollEd::su32PickCellMaxNumber     = 64;
+const orxFLOAT  ScrollEd::sfPickCellSize            = orx2F(256.0f);
+
 
 //! Static variables
 ScrollEd *ScrollEd::spoInstance = orxNULL;
@@ -406,9 +443,10 @@ ScrollEd &ScrollEd::GetInstance()
 
 ScrollEd::ScrollEd() : mpstButtonBank(orxNULL), mpstSetBank(orxNULL), mu32SelectedSet(0), mpstGrid(orxNULL), mpstLayerText(orxNULL), mpstNameText(orxNULL),
                        mpstPropertyText(orxNULL), mpstBasicCursor(orxNULL), mpoSelectedModel(orxNULL), mpoCursorObject(orxNULL), mpoSelection(NULL),
-                       mpstButtonHighlight(NULL), mzMapName(orxNULL), mfLocalTime(orxFLOAT_0), mfAutoSaveInterval(orxFLOAT_0),
-                       mfAutoSaveTimeStamp(orxFLOAT_0), mfZoom(orxFLOAT_0), mfWorkRotation(orxFLOAT_0), mu32LayerIndex(0), mu32CursorObjectIndex(0),
-                       mxFlags(FlagNone)
+                       mpstButtonHighlight(NULL), mastPickList(orxNULL), mpstPickObjectTable(orxNULL), mpstPickCellTable(orxNULL), mpstPickCellBank(orxNULL),
+                       mzMapName(orxNULL), mfLocalTime(orxFLOAT_0), mfAutoSaveInterval(orxFLOAT_0), mfAutoSaveTimeStamp(orxFLOAT_0), mfZoom(orxFLOAT_0),
+                       mfWorkRotation(orxFLOAT_0), mfPickCellSize(orxFLOAT_0), mu32LayerIndex(0), mu32CursorObjectIndex(0), mu32PickCount(0), mu32PickSize(0),
+                       mbPickGridDirty(orxTRUE), mxFlags(FlagNone)
 {
   // Clears other members
   orxVector_Copy(&mvWorkBase, &orxVECTOR_0);
@@ -416,6 +454,7 @@ ScrollEd::ScrollEd() : mpstButtonBank(orxNULL), mpstSetBank(orxNULL), mu32Select
   orxVector_Copy(&mvWorkScale, &orxVECTOR_0);
   orxVector_Copy(&mvWorkSize, &orxVECTOR_0);
   orxMemory_Zero(&mstButtonList, sizeof(orxLINKLIST));
+  orxMemory_Zero(&mstPickLargeCell, sizeof(PickCell));
 }
 
 ScrollEd::~ScrollEd()
@@ -442,6 +481,9 @@ orxSTATUS ScrollEd::Init()
     // Loads config file
     orxConfig_Load(szConfigFile);
 
+    // Invalidates resolved binders
+    ScrollBase::GetInstance().ClearBinderCache();
+
     // Enforces video mode
     orxDisplay_SetVideoMode(orxNULL);
 
@@ -589,6 +631,34 @@ void ScrollEd::Exit()
   // Exits sets
   ExitSets();
 
+  // Deletes picking grid
+  ClearPickGrid();
+  if(mastPickList)
+  {
+    orxMemory_Free(mastPickList);
+    mastPickList = orxNULL;
+  }
+  if(mpstPickObjectTable)
+  {
+    orxHashTable_Delete(mpstPickObjectTable);
+    mpstPickObjectTable = orxNULL;
+  }
+  if(mpstPickCellTable)
+  {
+    orxHashTable_Delete(mpstPickCellTable);
+    mpstPickCellTable = orxNULL;
+  }
+  if(mpstPickCellBank)
+  {
+    orxBank_Delete(mpstPickCellBank);
+    mpstPickCellBank = orxNULL;
+  }
+  if(mstPickLargeCell.mau64ObjectList)
+  {
+    orxMemory_Free(mstPickLargeCell.mau64ObjectList);
+    orxMemory_Zero(&mstPickLargeCell, sizeof(PickCell));
+  }
+
   // Exits from base game
   ScrollBase::GetInstance().Exit();
 }
@@ -650,6 +720,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
 
       // Reloads it
       roGame.LoadMap();
+      mbPickGridDirty = orxTRUE;
 
       // Starts game
       roGame.StartGame();
@@ -676,6 +747,9 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
         }
       }
 
+      // Updates picking grid
+      UpdatePickGrid();
+
       // Gets mouse position
       bIsMouseInScope = orxRender_GetWorldPosition(orxMouse_GetPosition(&vMousePos), orxNULL, &vMousePos) != orxNULL;
       vMousePos.fZ    = roGame.GetLayerDepth(mu32LayerIndex);
@@ -954,7 +1028,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
                       orxConfig_PopSection();
 
                       // Updates its position
-                      orxObject_SetPosition(mpoSelection->GetOrxObject(), &vPos);
+                      mpoSelection->SetPosition(vPos);
                     }
 
                     break;
@@ -1056,7 +1130,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
                         }
 
                         // Scales object
-                        orxObject_SetScale(pstOrxObject, &vScale);
+                        mpoSelection->SetScale(vScale);
 
                         // Uses tiling?
                         if(mpoSelection->TestFlags(ScrollObject::FlagTiled))
@@ -1143,7 +1217,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
                         }
 
                         // Rotates object
-                        orxObject_SetRotation(pstOrxObject, fRotation);
+                        mpoSelection->SetRotation(fRotation);
 
                         // Restores map section
                         orxConfig_PopSection();
@@ -1284,7 +1358,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
               orxObject_SetSmoothing(mpoSelection->GetOrxObject(), orxDISPLAY_SMOOTHING_OFF);
 
               // Updates its flags
-              mpoSelection->SetFlags(ScrollObject::FlagNone, ScrollObject::FlagSmoothed);
+              mpoSelection->SetFlags(ScrollObject::FlagDirty, ScrollObject::FlagSmoothed);
             }
             else
             {
@@ -1292,7 +1366,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
               orxObject_SetSmoothing(mpoSelection->GetOrxObject(), orxDISPLAY_SMOOTHING_ON);
 
               // Updates its flags
-              mpoSelection->SetFlags(ScrollObject::FlagSmoothed);
+              mpoSelection->SetFlags(ScrollObject::FlagSmoothed | ScrollObject::FlagDirty);
             }
           }
         }
@@ -1309,7 +1383,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
               orxObject_SetRepeat(mpoSelection->GetOrxObject(), orxFLOAT_1, orxFLOAT_1);
 
               // Updates its flags
-              mpoSelection->SetFlags(ScrollObject::FlagNone, ScrollObject::FlagTiled);
+              mpoSelection->SetFlags(ScrollObject::FlagDirty, ScrollObject::FlagTiled);
             }
             else
             {
@@ -1322,7 +1396,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
               orxObject_SetRepeat(mpoSelection->GetOrxObject(), orxMath_Abs(vScale.fX), orxMath_Abs(vScale.fY));
 
               // Updates its flags
-              mpoSelection->SetFlags(ScrollObject::FlagTiled);
+              mpoSelection->SetFlags(ScrollObject::FlagTiled | ScrollObject::FlagDirty);
             }
           }
         }
@@ -1452,6 +1526,7 @@ void ScrollEd::Update(const orxCLOCK_INFO &_rstInfo)
 
       // Reloads map
       roGame.LoadMap();
+      mbPickGridDirty = orxTRUE;
 
       // Updates layer
       UpdateLayerDisplay();
@@ -3316,7 +3391,7 @@ void ScrollEd::SetSelection(ScrollObject *_poObject)
   }
 }
 
-orxOBJECT *ScrollEd::PickObject(const orxVECTOR &_rvPos, orxU32 _u32GroupID) const
+orxOBJECT *ScrollEd::PickObject(const orxVECTOR &_rvPos, orxSTRINGID _stGroupID) const
 {
   orxOBJECT  *pstResult;
   orxVECTOR   vPick;
@@ -3331,8 +3406,46 @@ orxOBJECT *ScrollEd::PickObject(const orxVECTOR &_rvPos, orxU32 _u32GroupID) con
   // Updates picking position
   vPick.fZ -= orx2F(0.001f);
 
-  // Updates result
-  pstResult = orxObject_Pick(&vPick, _u32GroupID);
+  // Is picking grid up-to-date?
+  if(!mbPickGridDirty && !roGame.IsDifferentialMode())
+  {
+    const PickCell *apstCellList[2];
+    orxFLOAT        fDepth = orxFLOAT_MAX;
+
+    // Gets cell under position and the one holding large objects
+    apstCellList[0] = (const PickCell *)orxHashTable_Get(mpstPickCellTable, ScrollBase::GetCellKey(orxF2S(orxMath_Floor(vPick.fX / mfPickCellSize)), orxF2S(orxMath_Floor(vPick.fY / mfPickCellSize))));
+    apstCellList[1] = &mstPickLargeCell;
+
+    // Clears result
+    pstResult = orxNULL;
+
+    // For both cells
+    for(orxU32 i = 0; i < 2; i++)
+    {
+      // Valid?
+      if(apstCellList[i])
+      {
+        // For all its objects
+        for(orxU32 j = 0; j < apstCellList[i]->mu32Count; j++)
+        {
+          orxOBJECT *pstObject, *pstPicked;
+
+          // Still alive and picked (either itself or one of its owned children)?
+          if(((pstObject = orxOBJECT(orxStructure_Get(apstCellList[i]->mau64ObjectList[j]))) != orxNULL)
+          && ((pstPicked = PickOwnedObject(pstObject, vPick, _stGroupID, fDepth)) != orxNULL))
+          {
+            // Updates result
+            pstResult = pstPicked;
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    // Updates result
+    pstResult = orxObject_Pick(&vPick, _stGroupID);
+  }
 
   // Has result?
   if(pstResult)
@@ -3356,6 +3469,375 @@ orxOBJECT *ScrollEd::PickObject(const orxVECTOR &_rvPos, orxU32 _u32GroupID) con
   return pstResult;
 }
 
+orxOBJECT *ScrollEd::PickOwnedObject(orxOBJECT *_pstObject, const orxVECTOR &_rvPos, orxSTRINGID _stGroupID, orxFLOAT &_rfDepth) const
+{
+  orxOBJECT  *pstResult = orxNULL;
+  orxOBOX     stBox;
+  orxVECTOR   vPos;
+
+  // Enabled, in group, closest so far and under position (same rules as orxObject_Pick)?
+  if(orxObject_IsEnabled(_pstObject)
+  && ((_stGroupID == orxSTRINGID_UNDEFINED) || (orxObject_GetGroupID(_pstObject) == _stGroupID))
+  && orxObject_GetWorldPosition(_pstObject, &vPos)
+  && (vPos.fZ >= _rvPos.fZ)
+  && (vPos.fZ < _rfDepth)
+  && orxObject_GetBoundingBox(_pstObject, &stBox)
+  && orxOBox_2DIsInside(&stBox, &_rvPos))
+  {
+    // Updates result
+    pstResult = _pstObject;
+    _rfDepth  = vPos.fZ;
+  }
+
+  // For all owned children
+  for(orxOBJECT *pstChild = orxObject_GetOwnedChild(_pstObject);
+      pstChild;
+      pstChild = orxObject_GetOwnedSibling(pstChild))
+  {
+    orxOBJECT *pstPicked;
+
+    // Picked?
+    if((pstPicked = PickOwnedObject(pstChild, _rvPos, _stGroupID, _rfDepth)) != orxNULL)
+    {
+      // Updates result
+      pstResult = pstPicked;
+    }
+  }
+
+  // Done!
+  return pstResult;
+}
+
+void ScrollEd::UpdatePickGrid()
+{
+  // Gets game instance
+  ScrollBase &roGame = ScrollBase::GetInstance();
+
+  // Differential mode?
+  if(roGame.IsDifferentialMode())
+  {
+    // World boxes follow the camera: rebuilds once back to normal mode
+    mbPickGridDirty = orxTRUE;
+  }
+  // Needs rebuild?
+  else if(mbPickGridDirty)
+  {
+    // First use?
+    if(!mpstPickCellBank)
+    {
+      // Creates bank & tables
+      mpstPickCellBank    = orxBank_Create(256, sizeof(PickCell), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      mpstPickCellTable   = orxHashTable_Create(256, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      mpstPickObjectTable = orxHashTable_Create(256, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      orxASSERT(mpstPickCellBank && mpstPickCellTable && mpstPickObjectTable);
+    }
+
+    // Gets cell size
+    orxConfig_PushSection(szConfigSectionEditor);
+    mfPickCellSize = orxConfig_HasValue(szConfigPickCellSize) ? orxConfig_GetFloat(szConfigPickCellSize) : sfPickCellSize;
+    orxConfig_PopSection();
+
+    // Invalid?
+    if(mfPickCellSize <= orxFLOAT_0)
+    {
+      // Uses default one
+      mfPickCellSize = sfPickCellSize;
+    }
+
+    // Clears grid
+    ClearPickGrid();
+
+    // For all map objects
+    for(ScrollObject *poObject = roGame.GetNextObject();
+        poObject;
+        poObject = roGame.GetNextObject(poObject))
+    {
+      // Savable?
+      if(poObject->TestFlags(ScrollObject::FlagSave))
+      {
+        // Adds it
+        UpdatePickObject(poObject);
+      }
+    }
+
+    // Updates status
+    mbPickGridDirty = orxFALSE;
+  }
+  // Has selection?
+  else if(mpoSelection)
+  {
+    // Updates it, as it's the only object being edited
+    UpdatePickObject(mpoSelection);
+  }
+}
+
+void ScrollEd::UpdatePickObject(const ScrollObject *_poObject)
+{
+  orxAABOX  stBox;
+  orxU64    u64GUID;
+  orxU32    u32Index;
+
+  // No picking tables yet?
+  if(!mpstPickObjectTable)
+  {
+    // Will get added when the grid gets built
+    mbPickGridDirty = orxTRUE;
+  }
+  else
+  {
+    // Gets its GUID
+    u64GUID = _poObject->GetGUID();
+
+    // Gets its entry index
+    u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstPickObjectTable, u64GUID);
+
+    // Has a box?
+    if(GetPickBox(_poObject->GetOrxObject(), stBox))
+    {
+      // Already registered?
+      if(u32Index != 0)
+      {
+        PickEntry *pstEntry;
+
+        // Gets it
+        pstEntry = &mastPickList[u32Index - 1];
+
+        // Moved or resized?
+        if(orxMemory_Compare(&pstEntry->mstBox, &stBox, sizeof(orxAABOX)) != 0)
+        {
+          // Updates its cells
+          UpdatePickCells(u64GUID, pstEntry->mstBox, orxFALSE);
+          orxMemory_Copy(&pstEntry->mstBox, &stBox, sizeof(orxAABOX));
+          UpdatePickCells(u64GUID, pstEntry->mstBox, orxTRUE);
+        }
+      }
+      else
+      {
+        // Full?
+        if(mu32PickCount == mu32PickSize)
+        {
+          // Grows list
+          mu32PickSize  = mu32PickSize ? mu32PickSize << 1 : 256;
+          mastPickList  = (PickEntry *)orxMemory_Reallocate(mastPickList, mu32PickSize * sizeof(PickEntry), orxMEMORY_TYPE_MAIN);
+          orxASSERT(mastPickList);
+        }
+
+        // Adds entry
+        mastPickList[mu32PickCount].mu64GUID = u64GUID;
+        orxMemory_Copy(&mastPickList[mu32PickCount].mstBox, &stBox, sizeof(orxAABOX));
+        orxHashTable_Add(mpstPickObjectTable, u64GUID, (void *)(orxUPTR)(++mu32PickCount));
+
+        // Adds it to its cells
+        UpdatePickCells(u64GUID, stBox, orxTRUE);
+      }
+    }
+    // Registered?
+    else if(u32Index != 0)
+    {
+      // Removes it
+      RemovePickObject(u64GUID);
+    }
+  }
+}
+
+void ScrollEd::RemovePickObject(orxU64 _u64GUID)
+{
+  orxU32 u32Index;
+
+  // Registered?
+  if(mpstPickObjectTable && ((u32Index = (orxU32)(orxUPTR)orxHashTable_Get(mpstPickObjectTable, _u64GUID)) != 0))
+  {
+    // Removes it from its cells
+    UpdatePickCells(_u64GUID, mastPickList[u32Index - 1].mstBox, orxFALSE);
+
+    // Removes it from table
+    orxHashTable_Remove(mpstPickObjectTable, _u64GUID);
+
+    // Not last?
+    if(u32Index != mu32PickCount)
+    {
+      // Moves last entry in its slot
+      orxMemory_Copy(&mastPickList[u32Index - 1], &mastPickList[mu32PickCount - 1], sizeof(PickEntry));
+      orxHashTable_Set(mpstPickObjectTable, mastPickList[u32Index - 1].mu64GUID, (void *)(orxUPTR)u32Index);
+    }
+
+    // Updates count
+    mu32PickCount--;
+  }
+}
+
+void ScrollEd::ClearPickGrid()
+{
+  // Has cells?
+  if(mpstPickCellBank)
+  {
+    // For all cells
+    for(PickCell *pstCell = (PickCell *)orxBank_GetNext(mpstPickCellBank, orxNULL);
+        pstCell;
+        pstCell = (PickCell *)orxBank_GetNext(mpstPickCellBank, pstCell))
+    {
+      // Deletes its list
+      if(pstCell->mau64ObjectList)
+      {
+        orxMemory_Free(pstCell->mau64ObjectList);
+      }
+    }
+
+    // Clears them
+    orxBank_Clear(mpstPickCellBank);
+    orxHashTable_Clear(mpstPickCellTable);
+    orxHashTable_Clear(mpstPickObjectTable);
+  }
+
+  // Clears entries
+  mstPickLargeCell.mu32Count  = 0;
+  mu32PickCount               = 0;
+}
+
+void ScrollEd::UpdatePickCells(orxU64 _u64GUID, const orxAABOX &_rstBox, orxBOOL _bAdd)
+{
+  orxS32 s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+  // Gets covered cells
+  s32MinX = orxF2S(orxMath_Floor(_rstBox.vTL.fX / mfPickCellSize));
+  s32MinY = orxF2S(orxMath_Floor(_rstBox.vTL.fY / mfPickCellSize));
+  s32MaxX = orxF2S(orxMath_Floor(_rstBox.vBR.fX / mfPickCellSize));
+  s32MaxY = orxF2S(orxMath_Floor(_rstBox.vBR.fY / mfPickCellSize));
+
+  // For all cells (large objects get their own single cell)
+  for(orxS32 i = s32MinX; i <= s32MaxX; i++)
+  {
+    for(orxS32 j = s32MinY; j <= s32MaxY; j++)
+    {
+      PickCell *pstCell;
+
+      // Large object?
+      if((orxU32)(s32MaxX - s32MinX + 1) * (orxU32)(s32MaxY - s32MinY + 1) > su32PickCellMaxNumber)
+      {
+        // Uses large cell
+        pstCell = &mstPickLargeCell;
+
+        // Stops after this one
+        i = s32MaxX;
+        j = s32MaxY;
+      }
+      // New cell?
+      else if(((pstCell = (PickCell *)orxHashTable_Get(mpstPickCellTable, ScrollBase::GetCellKey(i, j))) == orxNULL) && _bAdd)
+      {
+        // Creates it
+        pstCell = (PickCell *)orxBank_Allocate(mpstPickCellBank);
+        orxASSERT(pstCell);
+        orxMemory_Zero(pstCell, sizeof(PickCell));
+        orxHashTable_Add(mpstPickCellTable, ScrollBase::GetCellKey(i, j), pstCell);
+      }
+
+      // Valid?
+      if(pstCell)
+      {
+        // Add?
+        if(_bAdd)
+        {
+          // Full?
+          if(pstCell->mu32Count == pstCell->mu32Size)
+          {
+            // Grows list
+            pstCell->mu32Size         = pstCell->mu32Size ? pstCell->mu32Size << 1 : 8;
+            pstCell->mau64ObjectList  = (orxU64 *)orxMemory_Reallocate(pstCell->mau64ObjectList, pstCell->mu32Size * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+            orxASSERT(pstCell->mau64ObjectList);
+          }
+
+          // Adds object
+          pstCell->mau64ObjectList[pstCell->mu32Count++] = _u64GUID;
+        }
+        else
+        {
+          // For all its objects
+          for(orxU32 k = 0; k < pstCell->mu32Count; k++)
+          {
+            // Found?
+            if(pstCell->mau64ObjectList[k] == _u64GUID)
+            {
+              // Moves last object in its slot
+              pstCell->mau64ObjectList[k] = pstCell->mau64ObjectList[--pstCell->mu32Count];
+              break;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+orxBOOL ScrollEd::GetPickBox(const orxOBJECT *_pstObject, orxAABOX &_rstBox) const
+{
+  orxOBOX stBox;
+  orxBOOL bResult = orxFALSE;
+
+  // Has bounding box?
+  if(orxObject_GetBoundingBox(_pstObject, &stBox))
+  {
+    orxVECTOR vOrigin;
+
+    // Gets its origin
+    orxVector_Sub(&vOrigin, &stBox.vPosition, &stBox.vPivot);
+
+    // Stores its extent, using all four corners
+    orxVector_Copy(&_rstBox.vTL, &vOrigin);
+    orxVector_Copy(&_rstBox.vBR, &vOrigin);
+    for(orxU32 i = 1; i < 4; i++)
+    {
+      orxVECTOR vCorner;
+
+      // Gets corner
+      orxVector_Copy(&vCorner, &vOrigin);
+      if(i & 1)
+      {
+        orxVector_Add(&vCorner, &vCorner, &stBox.vX);
+      }
+      if(i & 2)
+      {
+        orxVector_Add(&vCorner, &vCorner, &stBox.vY);
+      }
+
+      // Updates extent
+      orxVector_Min(&_rstBox.vTL, &_rstBox.vTL, &vCorner);
+      orxVector_Max(&_rstBox.vBR, &_rstBox.vBR, &vCorner);
+    }
+
+    // Updates result
+    bResult = orxTRUE;
+  }
+
+  // For all owned children
+  for(orxOBJECT *pstChild = orxObject_GetOwnedChild(_pstObject);
+      pstChild;
+      pstChild = orxObject_GetOwnedSibling(pstChild))
+  {
+    orxAABOX stChildBox;
+
+    // Has box?
+    if(GetPickBox(pstChild, stChildBox))
+    {
+      // Not the first one?
+      if(bResult)
+      {
+        // Merges it
+        orxVector_Min(&_rstBox.vTL, &_rstBox.vTL, &stChildBox.vTL);
+        orxVector_Max(&_rstBox.vBR, &_rstBox.vBR, &stChildBox.vBR);
+      }
+      else
+      {
+        // Stores it
+        orxMemory_Copy(&_rstBox, &stChildBox, sizeof(orxAABOX));
+        bResult = orxTRUE;
+      }
+    }
+  }
+
+  // Done!
+  return bResult;
+}
+
 ScrollObject *ScrollEd::AddObject(const ScrollObject *_poModel)
 {
   ScrollObject *poResult = orxNULL;
@@ -3419,6 +3901,9 @@ ScrollObject *ScrollEd::AddObject(const ScrollObject *_poModel)
       // Applies it to object
       orxObject_SetRepeat(pstOrxObject, fRepeatX, fRepeatY);
     }
+
+    // Adds it to picking grid
+    UpdatePickObject(poResult);
   }
 
   // Done!
@@ -3434,6 +3919,9 @@ void ScrollEd::RemoveObject(ScrollObject *_poObject)
     SetSelection();
   }
 
+  // Removes it from picking grid
+  RemovePickObject(_poObject->GetGUID());
+
   // Deletes it
   ScrollBase::GetInstance().DeleteObject(_poObject);
 }
@@ -33,6 +33,8 @@ class ScrollObject
   friend class ScrollEd;
   friend class ScrollObjectBinderBase;
   template <class O> friend class ScrollObjectBinder;
+  template <class O> friend struct ScrollHasUpdate;
+  template <class O> friend struct ScrollEventInterest;
 
 public:
 
@@ -45,6 +47,9 @@ public:
     FlagTiled     = 0x00000004,
     FlagRunTime   = 0x00000008,
     FlagPausable  = 0x00000010,
+    FlagParallel  = 0x00000020,
+    FlagPooled    = 0x00000040,
+    FlagDirty     = 0x00000080,
 
     MaskAll       = 0xFFFFFFFF
   };
@@ -56,9 +61,10 @@ public:
                 orxBOOL                 TestAllFlags(Flag _xTestFlags) const                      {return ((mxFlags & _xTestFlags) == _xTestFlags) ? orxTRUE : orxFALSE;}
                 Flag                    GetFlags(Flag _xMask = MaskAll) const                     {return (Flag)(mxFlags & _xMask);}
                 orxOBJECT *             GetOrxObject() const                                      {return mpstObject;}
-                const orxSTRING         GetName() const                                           {return macName;}
+                const orxSTRING         GetName() const;
                 const orxSTRING         GetModelName() const                                      {return mzModelName;}
                 orxU64                  GetGUID() const                                           {return orxStructure_GetGUID(mpstObject);}
+                orxBOOL                 IsFreeInPool() const                                      {return (TestFlags(FlagPooled) && (mu32PoolIndex == orxU32_UNDEFINED)) ? orxTRUE : orxFALSE;}
 
                 orxSTRINGID             GetGroupID() const;
                 void                    SetGroupID(orxSTRINGID _stGroupID, orxBOOL _bRecursive = orxTRUE);
@@ -121,6 +127,17 @@ public:
                 void                    PushConfigSection(orxBOOL _bPushInstanceSection = orxFALSE) const;
                 void                    PopConfigSection() const;
 
+                // Safe to call from a parallel update: queued and applied on the main thread after the update, applied immediately otherwise
+                void                    DeferPosition(const orxVECTOR &_rvPosition, orxBOOL _bWorld = orxFALSE);
+                void                    DeferRotation(orxFLOAT _fRotation, orxBOOL _bWorld = orxFALSE);
+                void                    DeferScale(const orxVECTOR &_rvScale, orxBOOL _bWorld = orxFALSE);
+                void                    DeferSpeed(const orxVECTOR &_rvSpeed, orxBOOL _bRelative = orxFALSE);
+                void                    DeferColor(const orxCOLOR &_rstColor, orxBOOL _bRecursive = orxTRUE);
+                void                    DeferAnim(const orxSTRING _zAnim, orxBOOL _bCurrent = orxFALSE, orxBOOL _bRecursive = orxTRUE);
+                void                    DeferFX(const orxSTRING _zFXName, orxBOOL _bRecursive = orxTRUE);
+                void                    DeferLifeTime(orxFLOAT _fLifeTime);
+                void                    DeferCommand(const orxSTRING _zCommand);
+
 protected:
 
                                         ScrollObject();
@@ -129,8 +146,27 @@ protected:
 
 private:
 
+  enum EventFlag
+  {
+    EventFlagNone       = 0x00000000,
+
+    EventFlagRender     = 0x00000001,
+    EventFlagShader     = 0x00000002,
+    EventFlagCollide    = 0x00000004,
+    EventFlagSeparate   = 0x00000008,
+    EventFlagNewAnim    = 0x00000010,
+    EventFlagAnimUpdate = 0x00000020,
+    EventFlagAnimEvent  = 0x00000040,
+    EventFlagFXStart    = 0x00000080,
+    EventFlagFXStop     = 0x00000100,
+    EventFlagFXLoop     = 0x00000200,
+
+    EventFlagAll        = 0x000003FF
+  };
+
   virtual       void                    OnCreate();
   virtual       void                    OnDelete();
+  virtual       void                    OnRecycle();
   virtual       void                    Update(const orxCLOCK_INFO &_rstInfo);
   virtual       void                    OnStartGame();
   virtual       void                    OnStopGame();
@@ -163,7 +199,13 @@ private:
                 Flag                    mxFlags;
                 orxLINKLIST_NODE        mstNode;
                 orxLINKLIST_NODE        mstChronoNode;
-                orxCHAR                 macName[16];
+                orxU32                  mu32UpdateIndex;
+                orxU32                  mu32BinderIndex;
+                orxU32                  mu32PoolIndex;
+                orxFLOAT                mfPoolLifeTime;
+                orxU32                  mu32EventFlags;
+  mutable       orxU32                  mu32RuntimeID;
+  mutable       orxCHAR                 macName[16];
 };
 
 
@@ -207,7 +249,7 @@ inline ScrollObject::Flag operator~(ScrollObject::Flag _x1)
 #ifdef __SCROLL_IMPL__
 
 //! Code
-ScrollObject::ScrollObject() : mpstObject(orxNULL), mzModelName(orxNULL), mxFlags(FlagNone)
+ScrollObject::ScrollObject() : mpstObject(orxNULL), mzModelName(orxNULL), mxFlags(FlagNone), mu32UpdateIndex(orxU32_UNDEFINED), mu32BinderIndex(orxU32_UNDEFINED), mu32PoolIndex(orxU32_UNDEFINED), mfPoolLifeTime(orx2F(-1.0f)), mu32EventFlags(EventFlagAll), mu32RuntimeID(orxU32_UNDEFINED)
 {
   // Clears nodes
   orxMemory_Zero(&mstNode, sizeof(orxLINKLIST_NODE));
@@ -300,21 +342,6 @@ orxVECTOR &ScrollObject::GetPosition(orxVECTOR &_rvPosition, orxBOOL _bWorld) co
   return _rvPosition;
 }
 
-void ScrollObject::SetPosition(const orxVECTOR &_rvPosition, orxBOOL _bWorld)
-{
-  // Local?
-  if(!_bWorld)
-  {
-    // Updates its position
-    orxObject_SetPosition(mpstObject, &_rvPosition);
-  }
-  else
-  {
-    // Updates its position
-    orxObject_SetWorldPosition(mpstObject, &_rvPosition);
-  }
-}
-
 orxVECTOR &ScrollObject::GetSize(orxVECTOR &_rvSize) const
 {
   // Updates result
@@ -361,6 +388,9 @@ void ScrollObject::SetScale(const orxVECTOR &_rvScale, orxBOOL _bWorld)
     // Updates its scale
     orxObject_SetWorldScale(mpstObject, &_rvScale);
   }
+
+  // Marks it as modified
+  SetFlags(FlagDirty);
 }
 
 orxFLOAT ScrollObject::GetRotation(orxBOOL _bWorld) const
@@ -396,6 +426,9 @@ void ScrollObject::SetRotation(orxFLOAT _fRotation, orxBOOL _bWorld)
     // Updates its rotation
     orxObject_SetWorldRotation(mpstObject, _fRotation);
   }
+
+  // Marks it as modified
+  SetFlags(FlagDirty);
 }
 
 orxVECTOR &ScrollObject::GetSpeed(orxVECTOR &_rvSpeed, orxBOOL _bRelative) const
@@ -416,21 +449,6 @@ orxVECTOR &ScrollObject::GetSpeed(orxVECTOR &_rvSpeed, orxBOOL _bRelative) const
   return _rvSpeed;
 }
 
-void ScrollObject::SetSpeed(const orxVECTOR &_rvSpeed, orxBOOL _bRelative)
-{
-  // Relative?
-  if(_bRelative)
-  {
-    // Updates its speed
-    orxObject_SetRelativeSpeed(mpstObject, &_rvSpeed);
-  }
-  else
-  {
-    // Updates its speed
-    orxObject_SetSpeed(mpstObject, &_rvSpeed);
-  }
-}
-
 orxCOLOR &ScrollObject::GetColor(orxCOLOR &_rstColor) const
 {
   // Updates result
@@ -453,6 +471,9 @@ void ScrollObject::SetColor(const orxCOLOR &_rstColor, orxBOOL _bRecursive)
     // Updates object's color
     orxObject_SetColor(mpstObject, &_rstColor);
   }
+
+  // Marks it as modified
+  SetFlags(FlagDirty);
 }
 
 void ScrollObject::GetFlip(orxBOOL &_rbFlipX, orxBOOL &_rbFlipY) const
@@ -665,7 +686,7 @@ orxFLOAT ScrollObject::GetLifeTime() const
   orxFLOAT fResult;
 
   // Updates result
-  fResult = orxObject_GetLifeTime(mpstObject);
+  fResult = TestFlags(FlagPooled) ? mfPoolLifeTime : orxObject_GetLifeTime(mpstObject);
 
   // Done!
   return fResult;
@@ -673,14 +694,23 @@ orxFLOAT ScrollObject::GetLifeTime() const
 
 void ScrollObject::SetLifeTime(orxFLOAT _fLifeTime)
 {
-  // Updates its lifetime
-  orxObject_SetLifeTime(mpstObject, _fLifeTime);
+  // Pooled?
+  if(TestFlags(FlagPooled))
+  {
+    // Updates its pool lifetime
+    mfPoolLifeTime = _fLifeTime;
+  }
+  else
+  {
+    // Updates its lifetime
+    orxObject_SetLifeTime(mpstObject, _fLifeTime);
+  }
 }
 
 void ScrollObject::PushConfigSection(orxBOOL _bPushInstanceSection) const
 {
   // Pushes its model section
-  orxConfig_PushSection(_bPushInstanceSection ? macName : mzModelName);
+  orxConfig_PushSection(_bPushInstanceSection ? GetName() : mzModelName);
 }
 
 ScrollObject *ScrollObject::FindChild(const orxSTRING _zPath) const
@@ -880,6 +910,10 @@ void ScrollObject::OnDelete()
 #endif // __SCROLL_DEBUG__
 }
 
+void ScrollObject::OnRecycle()
+{
+}
+
 void ScrollObject::Update(const orxCLOCK_INFO &_rstInfo)
 {
 }
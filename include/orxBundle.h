@@ -5,6 +5,9 @@
 
 #include "orx.h"
 
+#include <stdio.h>
+#include <stdlib.h>
+
 #define LZ4_FREESTANDING                    1
 
 #define LZ4_memmove(dst, src, size)         orxMemory_Move((dst), (src), (orxU32)(size))
@@ -29,6 +32,8 @@ const orxSTRING orxFASTCALL                 orxBundle_GetOutputName();
 
 #define orxBUNDLE_KZ_INCLUDE_PATH           "../include/"
 #define orxBUNDLE_KZ_INCLUDE_FILENAME       "orxBundleData.inc"
+#define orxBUNDLE_KZ_BLOB_EXTENSION         ".bin"
+#define orxBUNDLE_KZ_TEMP_EXTENSION         ".tmp"
 
 #define orxBUNDLE_KZ_RESOURCE_GROUP         "Bundle"
 #define orxBUNDLE_KZ_RESOURCE_STORAGE       "bundle:"
@@ -37,16 +42,44 @@ const orxSTRING orxFASTCALL                 orxBundle_GetOutputName();
 #define orxBUNDLE_KZ_CONFIG_SECTION         "Bundle"
 #define orxBUNDLE_KZ_CONFIG_INCLUDE_LIST    "IncludeList"
 #define orxBUNDLE_KZ_CONFIG_EXCLUDE_LIST    "ExcludeList"
+#define orxBUNDLE_KZ_CONFIG_CACHE_SIZE      "CacheSize"
+#define orxBUNDLE_KZ_CONFIG_ALIGNMENT       "Alignment"
+// EmbedMode = Binary: with GCC/Clang and no #embed support, the assembler needs the generated include's folder in its include paths (-Wa,-I, added by build/premake4.lua)
+#define orxBUNDLE_KZ_CONFIG_EMBED_MODE      "EmbedMode"
+#define orxBUNDLE_KZ_CONFIG_MANIFEST        "Manifest"
+#define orxBUNDLE_KZ_CONFIG_PREFETCH_SIZE   "PrefetchSize"
+#define orxBUNDLE_KZ_CONFIG_DICTIONARY_LIST "DictionaryList"
+#define orxBUNDLE_KZ_CONFIG_TRACE           "Trace"
+#define orxBUNDLE_KZ_DICTIONARY_NAME        "orx:bundle:dictionary"
+#define orxBUNDLE_KZ_DEFAULT_MANIFEST       "orxBundle.manifest"
+#define orxBUNDLE_KZ_EMBED_MODE_BINARY      "Binary"
 #define orxBUNDLE_KZ_LOG_TAG                orxANSI_KZ_COLOR_FG_YELLOW "[BUNDLE] " orxANSI_KZ_COLOR_RESET
 #define orxBUNDLE_KZ_RESOURCE_FORMAT        orxANSI_KZ_COLOR_FG_MAGENTA "[%s|%s]" orxANSI_KZ_COLOR_RESET
 #define orxBUNDLE_KU32_BUFFER_SIZE          16384
 #define orxBUNDLE_KU32_LINE_LENGTH          16
 #define orxBUNDLE_KU32_TABLE_SIZE           256
-#define orxBUNDLE_KU32_TOC_SIZE             1024
-
-#define orxBUNDLE_KZ_BINARY_TAG             "OBR1"
-#define orxBUNDLE_KU32_HEADER_INTRO_SIZE    (4 + 4)
-#define orxBUNDLE_KU32_HEADER_ENTRY_SIZE    (8 + 4 + 4 + 4)
+#define orxBUNDLE_KU32_LOCATION_SIZE        512
+#define orxBUNDLE_KU64_CACHE_SIZE           (32 * 1024 * 1024)
+#define orxBUNDLE_KU64_PREFETCH_SIZE        (8 * 1024 * 1024)
+#define orxBUNDLE_KU32_DICTIONARY_SIZE      (64 * 1024)
+#define orxBUNDLE_KU32_DICTIONARY_SAMPLE    64
+#define orxBUNDLE_KU32_DICTIONARY_GROUPS    16
+
+#define orxBUNDLE_KZ_BINARY_TAG             "OBR2"
+#define orxBUNDLE_KU32_HEADER_INTRO_SIZE    (4 + 4 + 4 + 4)
+#define orxBUNDLE_KU32_HEADER_ENTRY_SIZE    (8 + 8 + 8 + 8 + 8 + 4 + 4)
+#define orxBUNDLE_KU32_DEFAULT_ALIGNMENT    16
+
+#define orxBUNDLE_KZ_BINARY_TAG_V1          "OBR1"
+#define orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1 (4 + 4)
+#define orxBUNDLE_KU32_HEADER_ENTRY_SIZE_V1 (8 + 4 + 4 + 4)
+
+#define orxBUNDLE_KU32_ENTRY_FLAG_NONE      0x00000000  /**< No flag */
+#define orxBUNDLE_KU32_ENTRY_FLAG_STORED    0x00000001  /**< Payload isn't compressed */
+#define orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE 0x00000002  /**< Payload is shared with a previous entry */
+#define orxBUNDLE_KU32_ENTRY_FLAG_PREFETCH  0x00000004  /**< Payload is prefetched at startup */
+#define orxBUNDLE_KU32_ENTRY_FLAG_DICTIONARY 0x00000008 /**< Entry is the bundle's compression dictionary */
+#define orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY 0x00000010 /**< Payload is compressed with the bundle's dictionary */
 
 
 #ifdef orxBUNDLE_IMPL
@@ -69,23 +102,107 @@ const orxSTRING orxFASTCALL                 orxBundle_GetOutputName();
 
 typedef struct BundleData
 {
-  union
-  {
-    orxSTRINGID stNameID;
-    orxHANDLE   hResource;
-  };
+  orxSTRINGID   stNameID;
   const orxU8  *pu8Buffer;
   orxS64        s64Size;
   orxS64        s64FinalSize;
+  orxU32        u32Flags;
 } BundleData;
 
+typedef struct BundleEntry
+{
+  orxSTRINGID   stNameID;
+  orxS64        s64Offset;
+  orxS64        s64Size;
+  orxS64        s64FinalSize;
+  orxU64        u64Hash;
+  orxS64        s64Time;
+  orxU32        u32Flags;
+} BundleEntry;
+
+typedef struct BundleToC
+{
+  BundleEntry      *astEntryList;
+  orxSTRING         zLocation;
+  struct BundleToC *pstNext;
+  orxU8            *pu8Dictionary;
+  orxS64            s64Time;
+  orxS64            s64DictionarySize;
+  orxU32            u32Count;
+  orxU32            u32Alignment;
+  orxU32            u32KeyCheck;
+  orxU32            u32RefCount;
+  orxBOOL           bRetired;
+} BundleToC;
+
+typedef struct BundleCacheEntry
+{
+  orxLINKLIST_NODE  stNode;
+  orxSTRINGID       stNameID;
+  orxSTRINGID       stBundleID;
+  orxU8            *pu8Buffer;
+  orxS64            s64Size;
+  orxU32            u32RefCount;
+} BundleCacheEntry;
+
 typedef struct BundleResource
 {
-  orxS64        s64Cursor;
-  BundleData    stData;
-  orxU8        *pu8FinalBuffer;
+  orxS64            s64Cursor;
+  BundleData        stData;
+  orxSTRINGID       stBundleID;
+  orxS64            s64Offset;
+  orxU8            *pu8FinalBuffer;
+  BundleCacheEntry *pstCacheEntry;
+  const BundleToC  *pstToC;
 } BundleResource;
 
+typedef struct BundleStats
+{
+  orxU64            u64ReadSize;
+  orxU64            u64DecompressedSize;
+  orxDOUBLE         dReadTime;
+  orxDOUBLE         dDecryptTime;
+  orxDOUBLE         dDecompressTime;
+  orxU32            u32LocateCount;
+  orxU32            u32LookupCount;
+  orxU32            u32HandleHitCount;
+  orxU32            u32HandleMissCount;
+  orxU32            u32OpenCount;
+  orxU32            u32DecompressCount;
+} BundleStats;
+
+typedef struct BundleRecord
+{
+  orxSTRINGID       stNameID;
+  orxSTRING         zName;
+  orxDOUBLE         dTime;
+  orxU32            u32Order;
+} BundleRecord;
+
+typedef struct orxBUNDLE_RESOURCE_REF
+{
+  orxSTRINGID     stNameID;
+  const orxSTRING zLocation;
+  const orxSTRING zGroup;
+  const orxSTRING zRule;
+  orxS64          s64Offset;
+  orxS64          s64Size;
+  orxS64          s64FinalSize;
+  orxU64          u64Hash;
+  orxU32          u32Flags;
+  orxU32          u32DataIndex;
+  orxU32          u32Order;
+  orxU32          u32DictionaryGroup;
+} orxBUNDLE_RESOURCE_REF;
+
+typedef struct BundleDictionaryGroup
+{
+  const orxSTRING zName;
+  orxS64          s64FinalSize;
+  orxS64          s64PlainSize;
+  orxS64          s64Size;
+} BundleDictionaryGroup;
+
 #if __has_include(orxBUNDLE_KZ_INCLUDE_FILENAME)
   #include orxBUNDLE_KZ_INCLUDE_FILENAME
 #endif // __has_include(orxBUNDLE_KZ_INCLUDE_FILENAME)
@@ -97,11 +214,40 @@ typedef struct BundleResource
 typedef struct __orxBUNDLE_t
 {
   orxCHAR       acPrintBuffer[1024];
+  orxCHAR       acStatsBuffer[1024];
+  BundleStats   astStatsList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+  orxCHAR       aacLocationList[orxTHREAD_KU32_MAX_THREAD_NUMBER][orxBUNDLE_KU32_LOCATION_SIZE];
+  orxBOOL       abLocatingList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
   orxHASHTABLE *apstResourceTableList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+  orxU32        au32GenerationList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+  orxTHREAD_SEMAPHORE *pstSemaphore;
   orxHASHTABLE *pstToCTable;
+  BundleToC    *pstRetiredToCList;
   orxHASHTABLE *pstDataTable;
+  orxHASHTABLE *pstCacheTable;
+  orxBANK      *pstCacheBank;
+  orxLINKLIST   stCacheList;
+  orxS64        s64CacheSize;
+  orxS64        s64CacheBudget;
+  orxU32        u32CacheHitCount;
+  orxU32        u32CacheMissCount;
+  orxU32        u32CacheEvictionCount;
+  volatile orxU32 u32Generation;
+  orxBOOL       bTrace;
+  orxHASHTABLE *pstRecordTable;
+  orxBANK      *pstRecordBank;
+  orxSTRING     zManifest;
+  orxDOUBLE     dRecordTime;
+  orxU32        u32RecordCount;
+  volatile orxU32 u32PrefetchCount;
+  orxBOOL       bStopPrefetch;
   orxHANDLE     hResource;
+  BundleToC    *pstPreviousToC;
+  orxHANDLE     hPreviousResource;
+  orxCHAR       acOutputLocation[orxBUNDLE_KU32_LOCATION_SIZE];
+  orxCHAR       acTempLocation[orxBUNDLE_KU32_LOCATION_SIZE];
   orxU32        u32DataCount;
+  orxU32        u32StorageLength;
   orxBOOL       bProcess;
   orxBOOL       bInit;
 
@@ -130,174 +276,1829 @@ static orxBUNDLE sstBundle;
     } while(orxFALSE)
 #endif // __orxGCC__ || __orxLLVM__
 
-static orxINLINE void orxResource_WriteU32(orxHANDLE _hResource, orxU32 _u32Value)
-{
-  orxU8 u8Value;
+static orxINLINE void orxBundle_SetU32(orxU8 *_pu8Data, orxU32 _u32Value)
+{
+  _pu8Data[0] = (orxU8)(_u32Value & 0xFF);
+  _pu8Data[1] = (orxU8)((_u32Value >> 8) & 0xFF);
+  _pu8Data[2] = (orxU8)((_u32Value >> 16) & 0xFF);
+  _pu8Data[3] = (orxU8)((_u32Value >> 24) & 0xFF);
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_SetU64(orxU8 *_pu8Data, orxU64 _u64Value)
+{
+  orxBundle_SetU32(_pu8Data, (orxU32)(_u64Value & 0xFFFFFFFF));
+  orxBundle_SetU32(_pu8Data + 4, (orxU32)(_u64Value >> 32));
+
+  // Done!
+  return;
+}
+
+static orxINLINE orxU32 orxBundle_GetU32(const orxU8 *_pu8Data)
+{
+  // Done!
+  return (orxU32)_pu8Data[0] | ((orxU32)_pu8Data[1] << 8) | ((orxU32)_pu8Data[2] << 16) | ((orxU32)_pu8Data[3] << 24);
+}
+
+static orxINLINE orxU64 orxBundle_GetU64(const orxU8 *_pu8Data)
+{
+  // Done!
+  return (orxU64)orxBundle_GetU32(_pu8Data) | (((orxU64)orxBundle_GetU32(_pu8Data + 4)) << 32);
+}
+
+static orxINLINE orxU64 orxBundle_Hash(const orxU8 *_pu8Data, orxS64 _s64Size)
+{
+  const orxU8  *pu8Data;
+  orxU64        u64Result = 0xCBF29CE484222325ULL;
+
+  // FNV-1a
+  for(pu8Data = _pu8Data; pu8Data < _pu8Data + _s64Size; pu8Data++)
+  {
+    u64Result = (u64Result ^ *pu8Data) * 0x100000001B3ULL;
+  }
+
+  // Done!
+  return u64Result;
+}
+
+static orxINLINE orxU32 orxBundle_GetKeyCheck(const orxSTRING _zKey)
+{
+  // Done!
+  return (orxU32)orxString_Hash(_zKey);
+}
+
+static orxINLINE void orxBundle_Crypt(orxU8 *_pu8Data, orxS64 _s64Size, const orxSTRING _zKey)
+{
+  const orxU8  *pu8Key;
+  orxU8        *pu8Data;
+
+  // XORs data with key
+  for(pu8Key = (const orxU8 *)_zKey, pu8Data = _pu8Data;
+      pu8Data < _pu8Data + _s64Size;
+      pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)_zKey : pu8Key + 1, pu8Data++)
+  {
+    *pu8Data ^= *pu8Key;
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_Lock()
+{
+  // Waits for semaphore
+  orxThread_WaitSemaphore(sstBundle.pstSemaphore);
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_Unlock()
+{
+  // Signals semaphore
+  orxThread_SignalSemaphore(sstBundle.pstSemaphore);
+
+  // Done!
+  return;
+}
+
+static orxINLINE BundleStats *orxBundle_GetStats()
+{
+  orxU32 u32ThreadID;
+
+  // Gets current thread ID
+  u32ThreadID = orxThread_GetCurrent();
+  orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+
+  // Done!
+  return &(sstBundle.astStatsList[u32ThreadID]);
+}
+
+
+//! Code
+
+static orxINLINE const orxSTRING orxBundle_GetHumanReadableSize(orxS64 _s64Size, orxU32 _u32Decimals)
+{
+  static const orxSTRING  sazUnitList[] = {"B", "KB", "MB", "GB", "TB"};
+  static orxCHAR          sacBuffer[16];
+  orxU32                  u32UnitIndex;
+  orxFLOAT                fSize;
+
+  /* Finds best unit */
+  for(u32UnitIndex = 0, fSize = orxS2F(_s64Size);
+      (u32UnitIndex < orxARRAY_GET_ITEM_COUNT(sazUnitList) - 1) && (fSize > orx2F(1024.0f));
+      u32UnitIndex++, fSize *= orx2F(1.0f/1024.0f))
+    ;
+
+  // Prints it
+  orxString_NPrint(sacBuffer, sizeof(sacBuffer), "%.*g%s", (fSize >= orxFLOAT_1) ? orxF2U(log10f(fSize) + _u32Decimals + 1) : _u32Decimals + 1, fSize, sazUnitList[u32UnitIndex]);
+
+  // Done!
+  return sacBuffer;
+}
+
+void orxFASTCALL orxBundle_CommandIsProcessing(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  // Updates result
+  _pstResult->bValue = orxBundle_IsProcessing();
+
+  // Done!
+  return;
+}
+
+void orxFASTCALL orxBundle_CommandGetOutputName(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  // Updates result
+  _pstResult->zValue = orxBundle_GetOutputName();
+
+  // Done!
+  return;
+}
+
+void orxFASTCALL orxBundle_CommandStats(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  BundleStats stStats;
+  orxS32      s32Offset;
+  orxU32      i;
+
+  // Clears total
+  orxMemory_Zero(&stStats, sizeof(BundleStats));
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // For all threads
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.astStatsList); i++)
+  {
+    const BundleStats *pstStats;
+
+    // Gets its stats
+    pstStats = &(sstBundle.astStatsList[i]);
+
+    // Updates total
+    stStats.u64ReadSize         += pstStats->u64ReadSize;
+    stStats.u64DecompressedSize += pstStats->u64DecompressedSize;
+    stStats.dReadTime           += pstStats->dReadTime;
+    stStats.dDecryptTime        += pstStats->dDecryptTime;
+    stStats.dDecompressTime     += pstStats->dDecompressTime;
+    stStats.u32LocateCount      += pstStats->u32LocateCount;
+    stStats.u32LookupCount      += pstStats->u32LookupCount;
+    stStats.u32HandleHitCount   += pstStats->u32HandleHitCount;
+    stStats.u32HandleMissCount  += pstStats->u32HandleMissCount;
+    stStats.u32OpenCount        += pstStats->u32OpenCount;
+    stStats.u32DecompressCount  += pstStats->u32DecompressCount;
+  }
+
+  // Prints cache stats
+  s32Offset = orxString_NPrint(sstBundle.acStatsBuffer, sizeof(sstBundle.acStatsBuffer), "Hit: %u, Miss: %u, Eviction: %u, Cache: %u (%s", sstBundle.u32CacheHitCount, sstBundle.u32CacheMissCount, sstBundle.u32CacheEvictionCount, orxHashTable_GetCount(sstBundle.pstCacheTable), orxBundle_GetHumanReadableSize(sstBundle.s64CacheSize, 2));
+  s32Offset += orxString_NPrint(sstBundle.acStatsBuffer + s32Offset, sizeof(sstBundle.acStatsBuffer) - s32Offset, " / %s)", orxBundle_GetHumanReadableSize(sstBundle.s64CacheBudget, 2));
+
+  // Prints I/O stats
+  s32Offset += orxString_NPrint(sstBundle.acStatsBuffer + s32Offset, sizeof(sstBundle.acStatsBuffer) - s32Offset, ", Locate: %u, Lookup: %u, Open: %u, Handle: %u/%u, Read: %s in %.3fms", stStats.u32LocateCount, stStats.u32LookupCount, stStats.u32OpenCount, stStats.u32HandleHitCount, stStats.u32HandleHitCount + stStats.u32HandleMissCount, orxBundle_GetHumanReadableSize((orxS64)stStats.u64ReadSize, 2), stStats.dReadTime * 1000.0);
+  orxString_NPrint(sstBundle.acStatsBuffer + s32Offset, sizeof(sstBundle.acStatsBuffer) - s32Offset, ", Decrypt: %.3fms, Decompress: %u -> %s in %.3fms", stStats.dDecryptTime * 1000.0, stStats.u32DecompressCount, orxBundle_GetHumanReadableSize((orxS64)stStats.u64DecompressedSize, 2), stStats.dDecompressTime * 1000.0);
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Updates result
+  _pstResult->zValue = sstBundle.acStatsBuffer;
+
+  // Done!
+  return;
+}
+
+void orxFASTCALL orxBundle_CommandResetStats(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  // Gets current stats
+  orxBundle_CommandStats(_u32ArgNumber, _astArgList, _pstResult);
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Clears all stats
+  orxMemory_Zero(sstBundle.astStatsList, sizeof(sstBundle.astStatsList));
+  sstBundle.u32CacheHitCount      = 0;
+  sstBundle.u32CacheMissCount     = 0;
+  sstBundle.u32CacheEvictionCount = 0;
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_DeleteCacheEntry(BundleCacheEntry *_pstEntry)
+{
+  // Checks
+  orxASSERT(_pstEntry->u32RefCount == 0);
+
+  // Still cached?
+  if(orxLinkList_GetList(&(_pstEntry->stNode)) != orxNULL)
+  {
+    // Removes it
+    orxLinkList_Remove(&(_pstEntry->stNode));
+    orxHashTable_Remove(sstBundle.pstCacheTable, _pstEntry->stNameID);
+
+    // Updates cache size
+    sstBundle.s64CacheSize -= _pstEntry->s64Size;
+  }
+
+  // Frees its buffer
+  orxMemory_Free(_pstEntry->pu8Buffer);
+
+  // Deletes it
+  orxBank_Free(sstBundle.pstCacheBank, _pstEntry);
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_TrimCache()
+{
+  BundleCacheEntry *pstEntry, *pstNextEntry;
+
+  // For all cached entries, least recently used first, while over budget
+  for(pstEntry = (BundleCacheEntry *)orxLinkList_GetFirst(&(sstBundle.stCacheList));
+      (pstEntry != orxNULL) && (sstBundle.s64CacheSize > sstBundle.s64CacheBudget);
+      pstEntry = pstNextEntry)
+  {
+    // Gets next entry
+    pstNextEntry = (BundleCacheEntry *)orxLinkList_GetNext(&(pstEntry->stNode));
+
+    // Not in use?
+    if(pstEntry->u32RefCount == 0)
+    {
+      // Deletes it
+      orxBundle_DeleteCacheEntry(pstEntry);
+
+      // Updates stats
+      sstBundle.u32CacheEvictionCount++;
+    }
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_FlushCache(orxSTRINGID _stBundleID)
+{
+  BundleCacheEntry *pstEntry, *pstNextEntry;
+
+  // For all cached entries
+  for(pstEntry = (BundleCacheEntry *)orxLinkList_GetFirst(&(sstBundle.stCacheList));
+      pstEntry != orxNULL;
+      pstEntry = pstNextEntry)
+  {
+    // Gets next entry
+    pstNextEntry = (BundleCacheEntry *)orxLinkList_GetNext(&(pstEntry->stNode));
+
+    // From requested bundle?
+    if((_stBundleID == orxSTRINGID_UNDEFINED) || (pstEntry->stBundleID == _stBundleID))
+    {
+      // Not in use?
+      if(pstEntry->u32RefCount == 0)
+      {
+        // Deletes it
+        orxBundle_DeleteCacheEntry(pstEntry);
+      }
+      else
+      {
+        // Detaches it, it'll get deleted upon release
+        orxLinkList_Remove(&(pstEntry->stNode));
+        orxHashTable_Remove(sstBundle.pstCacheTable, pstEntry->stNameID);
+        sstBundle.s64CacheSize -= pstEntry->s64Size;
+      }
+    }
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_ClearCache()
+{
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Flushes all entries
+  orxBundle_FlushCache(orxSTRINGID_UNDEFINED);
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static orxINLINE BundleCacheEntry *orxBundle_RetainCacheEntry(orxSTRINGID _stNameID, orxSTRINGID _stBundleID)
+{
+  BundleCacheEntry *pstResult;
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Gets cached entry
+  pstResult = (BundleCacheEntry *)orxHashTable_Get(sstBundle.pstCacheTable, _stNameID);
+
+  // Found & from the same bundle?
+  if((pstResult != orxNULL) && (pstResult->stBundleID == _stBundleID))
+  {
+    // Updates its ref count
+    pstResult->u32RefCount++;
+
+    // Marks it as most recently used
+    orxLinkList_Remove(&(pstResult->stNode));
+    orxLinkList_AddEnd(&(sstBundle.stCacheList), &(pstResult->stNode));
+
+    // Updates stats
+    sstBundle.u32CacheHitCount++;
+  }
+  else
+  {
+    // Updates result
+    pstResult = orxNULL;
+
+    // Updates stats
+    sstBundle.u32CacheMissCount++;
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return pstResult;
+}
+
+static orxINLINE BundleCacheEntry *orxBundle_AddCacheEntry(orxSTRINGID _stNameID, orxSTRINGID _stBundleID, orxU8 *_pu8Buffer, orxS64 _s64Size)
+{
+  BundleCacheEntry *pstResult = orxNULL;
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Fits in the cache?
+  if((_s64Size > 0) && (_s64Size <= sstBundle.s64CacheBudget))
+  {
+    BundleCacheEntry *pstPrevious;
+
+    // Gets previous entry
+    pstPrevious = (BundleCacheEntry *)orxHashTable_Get(sstBundle.pstCacheTable, _stNameID);
+
+    // Found?
+    if(pstPrevious != orxNULL)
+    {
+      // Not in use?
+      if(pstPrevious->u32RefCount == 0)
+      {
+        // Deletes it
+        orxBundle_DeleteCacheEntry(pstPrevious);
+        pstPrevious = orxNULL;
+      }
+    }
+
+    // Free slot?
+    if(pstPrevious == orxNULL)
+    {
+      // Allocates entry
+      pstResult = (BundleCacheEntry *)orxBank_Allocate(sstBundle.pstCacheBank);
+      orxASSERT(pstResult != orxNULL);
+
+      // Inits it
+      orxMemory_Zero(pstResult, sizeof(BundleCacheEntry));
+      pstResult->stNameID     = _stNameID;
+      pstResult->stBundleID   = _stBundleID;
+      pstResult->pu8Buffer    = _pu8Buffer;
+      pstResult->s64Size      = _s64Size;
+      pstResult->u32RefCount  = 1;
+
+      // Stores it as most recently used
+      orxHashTable_Add(sstBundle.pstCacheTable, _stNameID, pstResult);
+      orxLinkList_AddEnd(&(sstBundle.stCacheList), &(pstResult->stNode));
+
+      // Updates cache size
+      sstBundle.s64CacheSize += _s64Size;
+
+      // Evicts unused entries if needed
+      orxBundle_TrimCache();
+    }
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return pstResult;
+}
+
+static orxINLINE void orxBundle_ReleaseCacheEntry(BundleCacheEntry *_pstEntry)
+{
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Checks
+  orxASSERT(_pstEntry->u32RefCount > 0);
+
+  // Updates its ref count
+  _pstEntry->u32RefCount--;
+
+  // Not in use anymore?
+  if(_pstEntry->u32RefCount == 0)
+  {
+    // Detached?
+    if(orxLinkList_GetList(&(_pstEntry->stNode)) == orxNULL)
+    {
+      // Deletes it
+      orxBundle_DeleteCacheEntry(_pstEntry);
+    }
+    else
+    {
+      // Evicts unused entries if needed
+      orxBundle_TrimCache();
+    }
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_ClearResourceTable(orxHASHTABLE *_pstResourceTable)
+{
+  orxHANDLE hIterator, hResource;
+
+  // For all resources
+  for(hIterator = orxHashTable_GetNext(_pstResourceTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&hResource);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(_pstResourceTable, hIterator, orxNULL, (void **)&hResource))
+  {
+    // Closes it
+    orxResource_Close(hResource);
+  }
+
+  // Clears table
+  orxHashTable_Clear(_pstResourceTable);
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_ClearResourceTables()
+{
+  orxU32 i;
+
+  // Checks
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  // For all resource tables
+  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.apstResourceTableList); i++)
+  {
+    // Clears it
+    orxBundle_ClearResourceTable(sstBundle.apstResourceTableList[i]);
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_DeleteToC(BundleToC *_pstToC)
+{
+  // Has entries?
+  if(_pstToC->astEntryList != orxNULL)
+  {
+    // Frees them
+    orxMemory_Free(_pstToC->astEntryList);
+  }
+
+  // Has location?
+  if(_pstToC->zLocation != orxNULL)
+  {
+    // Deletes it
+    orxString_Delete(_pstToC->zLocation);
+  }
+
+  // Has dictionary?
+  if(_pstToC->pu8Dictionary != orxNULL)
+  {
+    // Frees it
+    orxMemory_Free(_pstToC->pu8Dictionary);
+  }
+
+  // Frees it
+  orxMemory_Free(_pstToC);
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_ClearToCTable()
+{
+  orxHANDLE   hIterator;
+  BundleToC  *pstToC, **ppstToC;
+
+  // Checks
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // For all ToCs
+  for(hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstToC);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, hIterator, orxNULL, (void **)&pstToC))
+  {
+    // Valid?
+    if(pstToC != orxNULL)
+    {
+      // Retires it
+      pstToC->bRetired            = orxTRUE;
+      pstToC->pstNext             = sstBundle.pstRetiredToCList;
+      sstBundle.pstRetiredToCList = pstToC;
+    }
+  }
+
+  // Clears ToC table
+  orxHashTable_Clear(sstBundle.pstToCTable);
+
+  // For all retired ToCs
+  for(ppstToC = &(sstBundle.pstRetiredToCList); (pstToC = *ppstToC) != orxNULL;)
+  {
+    // Not referenced by any open handle?
+    if(pstToC->u32RefCount == 0)
+    {
+      // Deletes it
+      *ppstToC = pstToC->pstNext;
+      orxBundle_DeleteToC(pstToC);
+    }
+    else
+    {
+      // Keeps it, its last handle will delete it upon closing
+      ppstToC = &(pstToC->pstNext);
+    }
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static int orxBundle_CompareEntries(const void *_pEntry1, const void *_pEntry2)
+{
+  orxSTRINGID stID1, stID2;
+
+  // Gets IDs
+  stID1 = ((const BundleEntry *)_pEntry1)->stNameID;
+  stID2 = ((const BundleEntry *)_pEntry2)->stNameID;
+
+  // Done!
+  return (stID1 < stID2) ? -1 : (stID1 > stID2) ? 1 : 0;
+}
+
+static orxINLINE orxHANDLE orxBundle_GetResource(const orxSTRING _zLocation, orxSTRINGID _stLocationID)
+{
+  orxHANDLE hResult;
+  orxU32    u32ThreadID;
+
+  // Gets current thread ID
+  u32ThreadID = orxThread_GetCurrent();
+  orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+
+  // A bundle got replaced since this thread's last access?
+  if(sstBundle.au32GenerationList[u32ThreadID] != sstBundle.u32Generation)
+  {
+    // Closes all this thread's handles, they'll get reopened on demand
+    sstBundle.au32GenerationList[u32ThreadID] = sstBundle.u32Generation;
+    orxBundle_ClearResourceTable(sstBundle.apstResourceTableList[u32ThreadID]);
+  }
+
+  // Gets it from this thread's table
+  hResult = orxHashTable_Get(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)_stLocationID);
+
+  // Not found?
+  if(hResult == orxNULL)
+  {
+    orxCHAR acBuffer[orxBUNDLE_KU32_LOCATION_SIZE];
+
+    // Updates stats
+    sstBundle.astStatsList[u32ThreadID].u32HandleMissCount++;
+
+    // Updates result
+    hResult = orxHANDLE_UNDEFINED;
+
+    // No location?
+    if(_zLocation == orxNULL)
+    {
+      const BundleToC *pstToC;
+
+      // Gets it from its ToC
+      orxBundle_Lock();
+      if((pstToC = (const BundleToC *)orxHashTable_Get(sstBundle.pstToCTable, _stLocationID)) != orxNULL)
+      {
+        orxString_NPrint(acBuffer, sizeof(acBuffer), "%s", pstToC->zLocation);
+        _zLocation = acBuffer;
+      }
+      orxBundle_Unlock();
+    }
+
+    // Valid?
+    if(_zLocation != orxNULL)
+    {
+      // Opens it
+      hResult = orxResource_Open(_zLocation, orxFALSE);
+
+      // Success?
+      if(hResult != orxHANDLE_UNDEFINED)
+      {
+        orxSTATUS eResult;
+
+        // Adds it to table
+        eResult = orxHashTable_Add(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)_stLocationID, hResult);
+        orxASSERT(eResult != orxSTATUS_FAILURE);
+      }
+    }
+  }
+  else
+  {
+    // Updates stats
+    sstBundle.astStatsList[u32ThreadID].u32HandleHitCount++;
+  }
+
+  // Done!
+  return hResult;
+}
+
+static orxINLINE orxU32 orxBundle_FindEntry(const BundleToC *_pstToC, orxSTRINGID _stNameID)
+{
+  orxU32 u32Min, u32Max, u32Result = orxU32_UNDEFINED;
+
+  // Binary search
+  for(u32Min = 0, u32Max = _pstToC->u32Count; u32Min < u32Max;)
+  {
+    orxU32      u32Index;
+    orxSTRINGID stID;
+
+    // Gets middle entry
+    u32Index  = u32Min + ((u32Max - u32Min) >> 1);
+    stID      = _pstToC->astEntryList[u32Index].stNameID;
+
+    // Found?
+    if(stID == _stNameID)
+    {
+      // Updates result
+      u32Result = u32Index;
+      break;
+    }
+    else if(stID < _stNameID)
+    {
+      u32Min = u32Index + 1;
+    }
+    else
+    {
+      u32Max = u32Index;
+    }
+  }
+
+  // Done!
+  return u32Result;
+}
+
+static orxINLINE BundleToC *orxBundle_LoadToC(const orxSTRING _zLocation, orxHANDLE _hResource)
+{
+  orxU8       au8Intro[orxBUNDLE_KU32_HEADER_INTRO_SIZE];
+  BundleToC  *pstResult = orxNULL;
+
+  // Reads common intro
+  if((orxResource_Seek(_hResource, 0, orxSEEK_OFFSET_WHENCE_START) == 0)
+  && (orxResource_Read(_hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1, au8Intro, orxNULL, orxNULL) == orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1))
+  {
+    orxU32  u32EntrySize = 0, u32Alignment = 1, u32KeyCheck = 0;
+    orxBOOL bV1;
+
+    // Is a valid bundle?
+    if((bV1 = (orxMemory_Compare(orxBUNDLE_KZ_BINARY_TAG_V1, au8Intro, 4) == 0) ? orxTRUE : orxFALSE) != orxFALSE)
+    {
+      // Updates entry size
+      u32EntrySize = orxBUNDLE_KU32_HEADER_ENTRY_SIZE_V1;
+    }
+    else if((orxMemory_Compare(orxBUNDLE_KZ_BINARY_TAG, au8Intro, 4) == 0)
+         && (orxResource_Read(_hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE - orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1, au8Intro + orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1, orxNULL, orxNULL) == orxBUNDLE_KU32_HEADER_INTRO_SIZE - orxBUNDLE_KU32_HEADER_INTRO_SIZE_V1))
+    {
+      // Updates entry size & alignment
+      u32EntrySize = orxBUNDLE_KU32_HEADER_ENTRY_SIZE;
+      u32Alignment = orxBundle_GetU32(au8Intro + 8);
+      u32KeyCheck  = orxBundle_GetU32(au8Intro + 12);
+
+      // Wrong encryption key?
+      if(u32KeyCheck != orxBundle_GetKeyCheck(orxConfig_GetEncryptionKey()))
+      {
+        // Logs message
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, orxANSI_KZ_COLOR_FG_YELLOW "[Bundle]" orxANSI_KZ_COLOR_FG_RED " Bundle " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_RED " was created with a different encryption key, its content won't be readable.", _zLocation);
+      }
+    }
+
+    // Valid?
+    if(u32EntrySize != 0)
+    {
+      orxU8  *pu8Header = orxNULL;
+      orxS64  s64HeaderSize;
+      orxU64  u64EntryListSize;
+      orxU32  i, u32Count;
+
+      // Gets entry count, header & entry list sizes
+      u32Count          = orxBundle_GetU32(au8Intro + 4);
+      s64HeaderSize     = (orxS64)u32Count * u32EntrySize;
+      u64EntryListSize  = (orxU64)u32Count * sizeof(BundleEntry);
+
+      // Addressable?
+      if((s64HeaderSize == (orxS64)(orxU32)s64HeaderSize) && (u64EntryListSize == (orxU64)(orxU32)u64EntryListSize))
+      {
+        // Allocates header buffer
+        pu8Header = (orxU8 *)orxMemory_Allocate((orxU32)s64HeaderSize, orxMEMORY_TYPE_TEMP);
+        orxASSERT((pu8Header != orxNULL) || (u32Count == 0));
+      }
+
+      // Reads all entries at once
+      if(((pu8Header != orxNULL) || (u32Count == 0))
+      && (orxResource_Read(_hResource, s64HeaderSize, pu8Header, orxNULL, orxNULL) == s64HeaderSize))
+      {
+        // Creates ToC
+        pstResult = (BundleToC *)orxMemory_Allocate(sizeof(BundleToC), orxMEMORY_TYPE_MAIN);
+        orxASSERT(pstResult != orxNULL);
+        pstResult->zLocation          = orxString_Duplicate(_zLocation);
+        pstResult->pstNext            = orxNULL;
+        pstResult->pu8Dictionary      = orxNULL;
+        pstResult->s64Time            = 0;
+        pstResult->s64DictionarySize  = 0;
+        pstResult->u32Count           = u32Count;
+        pstResult->u32Alignment       = u32Alignment;
+        pstResult->u32KeyCheck        = u32KeyCheck;
+        pstResult->u32RefCount        = 0;
+        pstResult->bRetired           = orxFALSE;
+        pstResult->astEntryList       = (u32Count != 0) ? (BundleEntry *)orxMemory_Allocate((orxU32)u64EntryListSize, orxMEMORY_TYPE_MAIN) : orxNULL;
+        orxASSERT((pstResult->astEntryList != orxNULL) || (u32Count == 0));
+
+        // For all entries
+        for(i = 0; i < u32Count; i++)
+        {
+          const orxU8  *pu8Entry;
+          BundleEntry  *pstEntry;
+
+          // Gets it
+          pu8Entry = pu8Header + i * u32EntrySize;
+          pstEntry = &(pstResult->astEntryList[i]);
+
+          // Stores it
+          pstEntry->stNameID = (orxSTRINGID)orxBundle_GetU64(pu8Entry);
+          pstEntry->s64Time  = 0;
+          if(bV1 != orxFALSE)
+          {
+            pstEntry->s64Offset     = (orxS64)orxBundle_GetU32(pu8Entry + 8);
+            pstEntry->s64Size       = (orxS64)orxBundle_GetU32(pu8Entry + 8 + 4);
+            pstEntry->s64FinalSize  = (orxS64)orxBundle_GetU32(pu8Entry + 8 + 4 + 4);
+            pstEntry->u64Hash       = 0;
+            pstEntry->u32Flags      = orxBUNDLE_KU32_ENTRY_FLAG_NONE;
+          }
+          else
+          {
+            pstEntry->s64Offset     = (orxS64)orxBundle_GetU64(pu8Entry + 8);
+            pstEntry->s64Size       = (orxS64)orxBundle_GetU64(pu8Entry + 8 + 8);
+            pstEntry->s64FinalSize  = (orxS64)orxBundle_GetU64(pu8Entry + 8 + 8 + 8);
+            pstEntry->u64Hash       = orxBundle_GetU64(pu8Entry + 8 + 8 + 8 + 8);
+            pstEntry->u32Flags      = orxBundle_GetU32(pu8Entry + 8 + 8 + 8 + 8 + 8);
+          }
+        }
+
+        // Sorts entries by name ID
+        if(u32Count > 1)
+        {
+          qsort(pstResult->astEntryList, u32Count, sizeof(BundleEntry), &orxBundle_CompareEntries);
+        }
+
+        // Has dictionary?
+        if(((i = orxBundle_FindEntry(pstResult, orxString_Hash(orxBUNDLE_KZ_DICTIONARY_NAME))) != orxU32_UNDEFINED)
+        && (orxFLAG_TEST(pstResult->astEntryList[i].u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_DICTIONARY))
+        && (pstResult->astEntryList[i].s64Size == (orxS64)(orxU32)pstResult->astEntryList[i].s64Size))
+        {
+          const BundleEntry *pstEntry;
+
+          // Gets it
+          pstEntry = &(pstResult->astEntryList[i]);
+
+          // Allocates it
+          pstResult->pu8Dictionary = (orxU8 *)orxMemory_Allocate((orxU32)pstEntry->s64Size, orxMEMORY_TYPE_MAIN);
+          orxASSERT(pstResult->pu8Dictionary != orxNULL);
+
+          // Loads it
+          if((orxResource_Seek(_hResource, pstEntry->s64Offset, orxSEEK_OFFSET_WHENCE_START) == pstEntry->s64Offset)
+          && (orxResource_Read(_hResource, pstEntry->s64Size, pstResult->pu8Dictionary, orxNULL, orxNULL) == pstEntry->s64Size))
+          {
+            // Decrypts it
+            orxBundle_Crypt(pstResult->pu8Dictionary, pstEntry->s64Size, orxConfig_GetEncryptionKey());
+            pstResult->s64DictionarySize = pstEntry->s64Size;
+          }
+          else
+          {
+            // Frees it
+            orxMemory_Free(pstResult->pu8Dictionary);
+            pstResult->pu8Dictionary = orxNULL;
+          }
+        }
+      }
+      else
+      {
+        // Logs message
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, orxANSI_KZ_COLOR_FG_YELLOW "[Bundle]" orxANSI_KZ_COLOR_FG_RED " Bundle " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_RED " has an invalid or truncated header (" orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_FG_RED " entries), ignoring it.", _zLocation, u32Count);
+      }
+
+      // Frees header buffer
+      if(pu8Header != orxNULL)
+      {
+        orxMemory_Free(pu8Header);
+      }
+    }
+  }
+
+  // Done!
+  return pstResult;
+}
+
+// Retains a bundle's ToC, loading it if needed, and has to be paired with orxBundle_ReleaseToC()
+// Published ToCs are never modified (beside entry times, on hotload) and a ToC replaced by a hotload only gets deleted once its last reference has been released, they can thus be used without locking while retained
+static orxINLINE const BundleToC *orxBundle_GetToC(const orxSTRING _zLocation, orxSTRINGID _stLocationID)
+{
+  BundleToC *pstResult;
+
+  // Gets its ToC
+  orxBundle_Lock();
+  if((pstResult = (BundleToC *)orxHashTable_Get(sstBundle.pstToCTable, _stLocationID)) != orxNULL)
+  {
+    pstResult->u32RefCount++;
+  }
+  orxBundle_Unlock();
+
+  // Not loaded yet?
+  if(pstResult == orxNULL)
+  {
+    orxHANDLE hResource;
+
+    // Gets resource
+    hResource = orxBundle_GetResource(_zLocation, _stLocationID);
+
+    // Success?
+    if(hResource != orxHANDLE_UNDEFINED)
+    {
+      BundleToC *pstToC;
+
+      // Loads its ToC
+      pstToC = orxBundle_LoadToC(_zLocation, hResource);
+
+      // Success?
+      if(pstToC != orxNULL)
+      {
+        BundleToC **ppstToC;
+        orxU32      i;
+
+        // Stores its time, for hotload
+        pstToC->s64Time = orxResource_GetTime(_zLocation);
+
+        // For all entries
+        for(i = 0; i < pstToC->u32Count; i++)
+        {
+          // Stores its time
+          pstToC->astEntryList[i].s64Time = pstToC->s64Time;
+        }
+
+        // Publishes it, unless another thread was faster
+        orxBundle_Lock();
+        ppstToC = (BundleToC **)orxHashTable_Retrieve(sstBundle.pstToCTable, _stLocationID);
+        if(*ppstToC == orxNULL)
+        {
+          *ppstToC = pstToC;
+          pstToC   = orxNULL;
+        }
+        pstResult = *ppstToC;
+        pstResult->u32RefCount++;
+        orxBundle_Unlock();
+
+        // Wasn't published?
+        if(pstToC != orxNULL)
+        {
+          // Deletes it
+          orxBundle_DeleteToC(pstToC);
+        }
+      }
+    }
+  }
+
+  // Done!
+  return pstResult;
+}
+
+static orxINLINE void orxBundle_ReleaseToC(const BundleToC *_pstToC)
+{
+  BundleToC  *pstToC, **ppstToC;
+  orxBOOL     bDelete = orxFALSE;
+
+  // Gets ToC
+  pstToC = (BundleToC *)_pstToC;
+
+  // Updates its ref count
+  orxBundle_Lock();
+  orxASSERT(pstToC->u32RefCount > 0);
+  pstToC->u32RefCount--;
+
+  // Retired and not referenced anymore?
+  if((pstToC->u32RefCount == 0) && (pstToC->bRetired != orxFALSE))
+  {
+    // Removes it from retired list
+    for(ppstToC = &(sstBundle.pstRetiredToCList); *ppstToC != pstToC; ppstToC = &((*ppstToC)->pstNext))
+      ;
+    *ppstToC  = pstToC->pstNext;
+    bDelete   = orxTRUE;
+  }
+  orxBundle_Unlock();
+
+  // Should delete it?
+  if(bDelete != orxFALSE)
+  {
+    // Deletes it
+    orxBundle_DeleteToC(pstToC);
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE const orxSTRING orxBundle_GetLastSeparator(const orxSTRING _zLocation)
+{
+  const orxSTRING zSeparator;
+  const orxSTRING zResult = orxNULL;
+
+  // Finds last separator
+  for(zSeparator = orxString_SearchChar(_zLocation, orxRESOURCE_KC_LOCATION_SEPARATOR);
+      zSeparator != orxNULL;
+      zResult = zSeparator, zSeparator = orxString_SearchChar(zSeparator + 1, orxRESOURCE_KC_LOCATION_SEPARATOR))
+    ;
+
+  // Done!
+  return zResult;
+}
+
+static orxINLINE orxU32 orxBundle_GetAlignment()
+{
+  orxU32 u32Result;
+
+  // Pushes bundle section
+  orxConfig_PushSection(orxBUNDLE_KZ_CONFIG_SECTION);
+
+  // Gets payload alignment
+  u32Result = orxConfig_HasValue(orxBUNDLE_KZ_CONFIG_ALIGNMENT) ? orxConfig_GetU32(orxBUNDLE_KZ_CONFIG_ALIGNMENT) : orxBUNDLE_KU32_DEFAULT_ALIGNMENT;
+
+  // Not a power of two?
+  if((u32Result == 0) || ((u32Result & (u32Result - 1)) != 0))
+  {
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Invalid alignment " orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_FG_RED ", using " orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_FG_RED " instead" orxANSI_KZ_COLOR_RESET, u32Result, orxBUNDLE_KU32_DEFAULT_ALIGNMENT);
+
+    // Uses default
+    u32Result = orxBUNDLE_KU32_DEFAULT_ALIGNMENT;
+  }
+
+  // Pops config section
+  orxConfig_PopSection();
+
+  // Done!
+  return u32Result;
+}
+
+// Compares content found at a resource's offset with a buffer, hashes alone aren't enough to share payloads
+static orxINLINE orxBOOL orxBundle_HasSameContent(orxHANDLE _hResource, orxS64 _s64Offset, const orxU8 *_pu8Buffer, orxS64 _s64Size)
+{
+  orxU8   au8Chunk[orxBUNDLE_KU32_BUFFER_SIZE];
+  orxS64  s64Done, s64ChunkSize;
+  orxBOOL bResult;
+
+  // Seeks content
+  bResult = (orxResource_Seek(_hResource, _s64Offset, orxSEEK_OFFSET_WHENCE_START) == _s64Offset) ? orxTRUE : orxFALSE;
+
+  // For all chunks
+  for(s64Done = 0; (bResult != orxFALSE) && (s64Done < _s64Size); s64Done += s64ChunkSize)
+  {
+    // Reads & compares it
+    s64ChunkSize  = orxMIN(_s64Size - s64Done, (orxS64)sizeof(au8Chunk));
+    bResult       = ((orxResource_Read(_hResource, s64ChunkSize, au8Chunk, orxNULL, orxNULL) == s64ChunkSize)
+                  && (orxMemory_Compare(au8Chunk, _pu8Buffer + s64Done, (orxU32)s64ChunkSize) == 0)) ? orxTRUE : orxFALSE;
+  }
+
+  // Done!
+  return bResult;
+}
+
+// Compares a resource's whole content with a buffer
+static orxINLINE orxBOOL orxBundle_IsSameResource(const orxSTRING _zLocation, const orxU8 *_pu8Buffer, orxS64 _s64Size)
+{
+  orxHANDLE hResource;
+  orxBOOL   bResult = orxFALSE;
+
+  // Opens it
+  hResource = orxResource_Open(_zLocation, orxFALSE);
+
+  // Success?
+  if(hResource != orxHANDLE_UNDEFINED)
+  {
+    // Compares its content
+    bResult = orxBundle_HasSameContent(hResource, 0, _pu8Buffer, _s64Size);
+
+    // Closes it
+    orxResource_Close(hResource);
+  }
+
+  // Done!
+  return bResult;
+}
+
+// Upgrade command: rewrites any bundle (OBR1 or OBR2) as an aligned & deduplicated OBR2 bundle
+void orxFASTCALL orxBundle_CommandUpgrade(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  const orxSTRING zInput;
+  const orxSTRING zOutput;
+  orxHANDLE       hInput = orxHANDLE_UNDEFINED, hOutput = orxHANDLE_UNDEFINED;
+  BundleToC      *pstToC = orxNULL;
+
+  // Updates result
+  _pstResult->bValue = orxFALSE;
+
+  // Locates input & output
+  zInput  = orxResource_Locate(orxBUNDLE_KZ_RESOURCE_GROUP, _astArgList[0].zValue);
+  zOutput = orxResource_LocateInStorage(orxBUNDLE_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, _astArgList[1].zValue);
+
+  // Same location? (opening the output would truncate the input before its payloads get read)
+  if((zInput != orxNULL) && (zOutput != orxNULL) && (orxString_ICompare(orxResource_GetPath(zInput), orxResource_GetPath(zOutput)) == 0))
+  {
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Can't upgrade " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED " in place, please use a different output!" orxANSI_KZ_COLOR_RESET, orxResource_GetPath(zInput));
+  }
+  // Opens input & output, loads input's ToC
+  else if((zInput != orxNULL)
+       && (zOutput != orxNULL)
+       && ((hInput = orxResource_Open(zInput, orxFALSE)) != orxHANDLE_UNDEFINED)
+       && ((pstToC = orxBundle_LoadToC(zInput, hInput)) != orxNULL)
+       && ((hOutput = orxResource_Open(zOutput, orxTRUE)) != orxHANDLE_UNDEFINED))
+  {
+    orxHASHTABLE     *pstContentTable;
+    const orxSTRING   zKey;
+    orxU8            *pu8Header, *pu8Entry;
+    orxS64           *as64InputOffsetList;
+    orxS64            s64Offset;
+    orxU32            i, u32HeaderSize, u32Alignment;
+    orxBOOL           bSuccess = orxTRUE;
+
+    // Gets encryption key & alignment
+    zKey          = orxConfig_GetEncryptionKey();
+    u32Alignment  = orxBundle_GetAlignment();
+
+    // Creates content table
+    pstContentTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+    orxASSERT(pstContentTable != orxNULL);
+
+    // Allocates header
+    u32HeaderSize = orxBUNDLE_KU32_HEADER_INTRO_SIZE + pstToC->u32Count * orxBUNDLE_KU32_HEADER_ENTRY_SIZE;
+    pu8Header     = (orxU8 *)orxMemory_Allocate(u32HeaderSize, orxMEMORY_TYPE_TEMP);
+    orxASSERT(pu8Header != orxNULL);
+    orxMemory_Zero(pu8Header, u32HeaderSize);
+
+    // Allocates input offsets (entries get their output offsets as they're written)
+    as64InputOffsetList = (orxS64 *)orxMemory_Allocate(orxMAX(pstToC->u32Count, 1) * sizeof(orxS64), orxMEMORY_TYPE_TEMP);
+    orxASSERT(as64InputOffsetList != orxNULL);
+
+    // For all entries
+    for(i = 0, s64Offset = (orxS64)u32HeaderSize; (bSuccess != orxFALSE) && (i < pstToC->u32Count); i++)
+    {
+      BundleEntry        *pstEntry;
+      const BundleEntry  *pstOriginalEntry;
+      orxU8              *pu8Buffer;
+
+      // Gets it
+      pstEntry = &(pstToC->astEntryList[i]);
+
+      // Stores its input offset
+      as64InputOffsetList[i] = pstEntry->s64Offset;
+
+      // Reads its payload
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)pstEntry->s64Size, orxMEMORY_TYPE_TEMP);
+      orxASSERT(pu8Buffer != orxNULL);
+      bSuccess = ((orxResource_Seek(hInput, pstEntry->s64Offset, orxSEEK_OFFSET_WHENCE_START) == pstEntry->s64Offset)
+               && (orxResource_Read(hInput, pstEntry->s64Size, pu8Buffer, orxNULL, orxNULL) == pstEntry->s64Size)) ? orxTRUE : orxFALSE;
+
+      // No content hash?
+      if((bSuccess != orxFALSE) && (pstEntry->u64Hash == 0))
+      {
+        // Decrypts it
+        orxBundle_Crypt(pu8Buffer, pstEntry->s64Size, zKey);
+
+        // Stored?
+        if(orxFLAG_TEST(pstEntry->u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_STORED))
+        {
+          // Computes its hash
+          pstEntry->u64Hash = orxBundle_Hash(pu8Buffer, pstEntry->s64Size);
+        }
+        else
+        {
+          orxU8 *pu8FinalBuffer;
+
+          // Decompresses it
+          pu8FinalBuffer = (orxU8 *)orxMemory_Allocate((orxU32)pstEntry->s64FinalSize, orxMEMORY_TYPE_TEMP);
+          orxASSERT(pu8FinalBuffer != orxNULL);
+          if(LZ4_decompress_safe((const char *)pu8Buffer, (char *)pu8FinalBuffer, (int)pstEntry->s64Size, (int)pstEntry->s64FinalSize) == (int)pstEntry->s64FinalSize)
+          {
+            // Computes its hash
+            pstEntry->u64Hash = orxBundle_Hash(pu8FinalBuffer, pstEntry->s64FinalSize);
+          }
+          else
+          {
+            // Updates status
+            bSuccess = orxFALSE;
+          }
+          orxMemory_Free(pu8FinalBuffer);
+        }
+
+        // Encrypts it back
+        orxBundle_Crypt(pu8Buffer, pstEntry->s64Size, zKey);
+      }
+
+      // Success?
+      if(bSuccess != orxFALSE)
+      {
+        // Same content already written?
+        if(((pstOriginalEntry = (const BundleEntry *)orxHashTable_Get(pstContentTable, pstEntry->u64Hash)) != orxNULL)
+        && (pstOriginalEntry->s64FinalSize == pstEntry->s64FinalSize)
+        && (pstOriginalEntry->s64Size == pstEntry->s64Size)
+        && ((pstOriginalEntry->u32Flags & (orxBUNDLE_KU32_ENTRY_FLAG_STORED | orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY)) == (pstEntry->u32Flags & (orxBUNDLE_KU32_ENTRY_FLAG_STORED | orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY)))
+        && (orxBundle_HasSameContent(hInput, as64InputOffsetList[pstOriginalEntry - pstToC->astEntryList], pu8Buffer, pstEntry->s64Size) != orxFALSE))
+        {
+          // Shares its payload
+          pstEntry->s64Offset = pstOriginalEntry->s64Offset;
+          pstEntry->s64Size   = pstOriginalEntry->s64Size;
+          pstEntry->u32Flags  = pstOriginalEntry->u32Flags | orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE;
+        }
+        else
+        {
+          // Outputs aligned payload
+          s64Offset = orxALIGN(s64Offset, (orxS64)u32Alignment);
+          orxResource_Seek(hOutput, s64Offset, orxSEEK_OFFSET_WHENCE_START);
+          orxResource_Write(hOutput, pstEntry->s64Size, pu8Buffer, orxNULL, orxNULL);
+
+          // Updates entry
+          pstEntry->s64Offset = s64Offset;
+          pstEntry->u32Flags &= ~orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE;
+          s64Offset          += pstEntry->s64Size;
+
+          // Registers its content
+          orxHashTable_Set(pstContentTable, pstEntry->u64Hash, pstEntry);
+        }
+      }
+      else
+      {
+        // Logs message
+        orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Can't upgrade " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED ": invalid decryption key or corrupted data, aborting!" orxANSI_KZ_COLOR_RESET, orxString_GetFromID(pstEntry->stNameID));
+      }
+
+      // Frees buffer
+      orxMemory_Free(pu8Buffer);
+    }
+
+    // Success?
+    if(bSuccess != orxFALSE)
+    {
+      // Inits intro
+      orxMemory_Copy(pu8Header, orxBUNDLE_KZ_BINARY_TAG, 4);
+      orxBundle_SetU32(pu8Header + 4, pstToC->u32Count);
+      orxBundle_SetU32(pu8Header + 8, u32Alignment);
+      orxBundle_SetU32(pu8Header + 12, orxBundle_GetKeyCheck(zKey));
+
+      // For all entries
+      for(i = 0, pu8Entry = pu8Header + orxBUNDLE_KU32_HEADER_INTRO_SIZE; i < pstToC->u32Count; i++, pu8Entry += orxBUNDLE_KU32_HEADER_ENTRY_SIZE)
+      {
+        const BundleEntry *pstEntry;
+
+        // Gets it
+        pstEntry = &(pstToC->astEntryList[i]);
+
+        // Writes its header entry
+        orxBundle_SetU64(pu8Entry, (orxU64)pstEntry->stNameID);
+        orxBundle_SetU64(pu8Entry + 8, (orxU64)pstEntry->s64Offset);
+        orxBundle_SetU64(pu8Entry + 8 + 8, (orxU64)pstEntry->s64Size);
+        orxBundle_SetU64(pu8Entry + 8 + 8 + 8, (orxU64)pstEntry->s64FinalSize);
+        orxBundle_SetU64(pu8Entry + 8 + 8 + 8 + 8, pstEntry->u64Hash);
+        orxBundle_SetU32(pu8Entry + 8 + 8 + 8 + 8 + 8, pstEntry->u32Flags);
+      }
+
+      // Outputs header
+      orxResource_Seek(hOutput, 0, orxSEEK_OFFSET_WHENCE_START);
+      orxResource_Write(hOutput, u32HeaderSize, pu8Header, orxNULL, orxNULL);
+
+      // Logs message
+      orxLOG(orxBUNDLE_KZ_LOG_TAG "Upgraded " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET " -> " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET " (" orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_RESET " resources)", orxResource_GetPath(zInput), orxResource_GetPath(zOutput), pstToC->u32Count);
+
+      // Updates result
+      _pstResult->bValue = orxTRUE;
+    }
+
+    // Frees header & input offsets
+    orxMemory_Free(pu8Header);
+    orxMemory_Free(as64InputOffsetList);
+
+    // Deletes content table
+    orxHashTable_Delete(pstContentTable);
+  }
+
+  // Cleans up
+  if(pstToC != orxNULL)
+  {
+    orxBundle_DeleteToC(pstToC);
+  }
+  if(hInput != orxHANDLE_UNDEFINED)
+  {
+    orxResource_Close(hInput);
+  }
+  if(hOutput != orxHANDLE_UNDEFINED)
+  {
+    orxResource_Close(hOutput);
+  }
+
+  // Done!
+  return;
+}
+
+static int orxBundle_CompareResources(const void *_pRef1, const void *_pRef2)
+{
+  orxU32 u32Order1, u32Order2;
+
+  // Gets orders
+  u32Order1 = (*(const orxBUNDLE_RESOURCE_REF **)_pRef1)->u32Order;
+  u32Order2 = (*(const orxBUNDLE_RESOURCE_REF **)_pRef2)->u32Order;
+
+  // Done!
+  return (u32Order1 < u32Order2) ? -1 : (u32Order1 > u32Order2) ? 1 : 0;
+}
+
+static int orxBundle_CompareRecords(const void *_pRecord1, const void *_pRecord2)
+{
+  orxU32 u32Order1, u32Order2;
+
+  // Gets orders
+  u32Order1 = (*(const BundleRecord **)_pRecord1)->u32Order;
+  u32Order2 = (*(const BundleRecord **)_pRecord2)->u32Order;
+
+  // Done!
+  return (u32Order1 < u32Order2) ? -1 : (u32Order1 > u32Order2) ? 1 : 0;
+}
+
+// Reorders resources following a recorded manifest (unlisted ones keep their relative order at the end) and flags the first ones for prefetching
+static orxINLINE orxBANK *orxBundle_SortResources(orxBANK *_pstResourceBank, const orxSTRING _zManifest, orxS64 _s64PrefetchSize)
+{
+  const orxSTRING zLocation;
+  orxHANDLE       hManifest = orxHANDLE_UNDEFINED;
+  orxBANK        *pstResult = _pstResourceBank;
+
+  // Opens manifest
+  if(((zLocation = orxResource_Locate(orxBUNDLE_KZ_RESOURCE_GROUP, _zManifest)) != orxNULL)
+  && ((hManifest = orxResource_Open(zLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+  {
+    orxS64  s64Size;
+    orxCHAR *pcManifest;
+
+    // Allocates its content
+    s64Size     = orxResource_GetSize(hManifest);
+    pcManifest  = (orxCHAR *)orxMemory_Allocate((orxU32)s64Size + 1, orxMEMORY_TYPE_TEMP);
+    orxASSERT(pcManifest != orxNULL);
+
+    // Reads it
+    if(orxResource_Read(hManifest, s64Size, pcManifest, orxNULL, orxNULL) == s64Size)
+    {
+      orxBUNDLE_RESOURCE_REF  **apstRefList, *pstResourceRef;
+      orxHASHTABLE             *pstOrderTable;
+      orxCHAR                  *pcLine, *pcNext;
+      orxS64                    s64Prefetch = 0;
+      orxU32                    i, u32Count, u32Order, u32PrefetchCount = 0;
+
+      // Terminates content
+      pcManifest[s64Size] = orxCHAR_NULL;
+
+      // Creates order table
+      pstOrderTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+      orxASSERT(pstOrderTable != orxNULL);
+
+      // For all lines: <time> <name>
+      for(pcLine = pcManifest, u32Order = 0; *pcLine != orxCHAR_NULL; pcLine = pcNext)
+      {
+        orxCHAR *pcName;
+
+        // Finds line end
+        for(pcNext = pcLine; (*pcNext != orxCHAR_NULL) && (*pcNext != orxCHAR_CR) && (*pcNext != orxCHAR_LF); pcNext++)
+          ;
+        if(*pcNext != orxCHAR_NULL)
+        {
+          *pcNext++ = orxCHAR_NULL;
+        }
+
+        // Finds name
+        for(pcName = pcLine; (*pcName != orxCHAR_NULL) && (*pcName != ' '); pcName++)
+          ;
+
+        // Valid?
+        if((*pcName == ' ') && (*(pcName + 1) != orxCHAR_NULL))
+        {
+          // Stores its order, keeping the first occurrence
+          if(orxHashTable_Add(pstOrderTable, orxString_Hash(pcName + 1), (void *)(orxUPTR)(u32Order + 1)) != orxSTATUS_FAILURE)
+          {
+            u32Order++;
+          }
+        }
+      }
+
+      // Creates ref list
+      u32Count    = orxBank_GetCount(_pstResourceBank);
+      apstRefList = (orxBUNDLE_RESOURCE_REF **)orxMemory_Allocate(u32Count * sizeof(orxBUNDLE_RESOURCE_REF *), orxMEMORY_TYPE_TEMP);
+      orxASSERT(apstRefList != orxNULL);
+
+      // For all refs
+      for(pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, orxNULL), i = 0;
+          pstResourceRef != orxNULL;
+          pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, pstResourceRef), i++)
+      {
+        orxUPTR uOrder;
+
+        // Gets its order, unlisted ones after all listed ones
+        uOrder                    = (orxUPTR)orxHashTable_Get(pstOrderTable, pstResourceRef->stNameID);
+        pstResourceRef->u32Order  = (uOrder != 0) ? (orxU32)(uOrder - 1) : u32Order + i;
+        apstRefList[i]            = pstResourceRef;
+      }
+
+      // Sorts them
+      qsort(apstRefList, u32Count, sizeof(orxBUNDLE_RESOURCE_REF *), &orxBundle_CompareResources);
+
+      // Creates new bank
+      pstResult = orxBank_Create(orxBUNDLE_KU32_TABLE_SIZE, sizeof(orxBUNDLE_RESOURCE_REF), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+      orxASSERT(pstResult != orxNULL);
+
+      // For all sorted refs
+      for(i = 0; i < u32Count; i++)
+      {
+        // Copies it
+        pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_Allocate(pstResult);
+        orxASSERT(pstResourceRef != orxNULL);
+        orxMemory_Copy(pstResourceRef, apstRefList[i], sizeof(orxBUNDLE_RESOURCE_REF));
+
+        // Listed and within prefetch budget?
+        if((pstResourceRef->u32Order < u32Order)
+        && (s64Prefetch + pstResourceRef->s64FinalSize <= _s64PrefetchSize))
+        {
+          // Flags it
+          pstResourceRef->u32Flags |= orxBUNDLE_KU32_ENTRY_FLAG_PREFETCH;
+          s64Prefetch              += pstResourceRef->s64FinalSize;
+          u32PrefetchCount++;
+        }
+      }
+
+      // Logs message
+      orxLOG(orxBUNDLE_KZ_LOG_TAG "Laying out resources following " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET " (" orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_RESET " recorded), prefetching " orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_RESET " resources " orxANSI_KZ_COLOR_FG_GREEN "(%s)" orxANSI_KZ_COLOR_RESET, _zManifest, u32Order, u32PrefetchCount, orxBundle_GetHumanReadableSize(s64Prefetch, 2));
+
+      // Deletes old bank
+      orxBank_Delete(_pstResourceBank);
+
+      // Frees ref list
+      orxMemory_Free(apstRefList);
+
+      // Deletes order table
+      orxHashTable_Delete(pstOrderTable);
+    }
+
+    // Frees content
+    orxMemory_Free(pcManifest);
+
+    // Closes manifest
+    orxResource_Close(hManifest);
+  }
+  else
+  {
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Can't open manifest " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED ", keeping default order" orxANSI_KZ_COLOR_RESET, _zManifest);
+  }
+
+  // Done!
+  return pstResult;
+}
+
+static orxINLINE void orxBundle_RecordLocate(orxSTRINGID _stNameID, const orxSTRING _zName)
+{
+  BundleRecord **ppstRecord;
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // New resource?
+  ppstRecord = (BundleRecord **)orxHashTable_Retrieve(sstBundle.pstRecordTable, _stNameID);
+  if(*ppstRecord == orxNULL)
+  {
+    BundleRecord *pstRecord;
+
+    // Creates its record
+    pstRecord = (BundleRecord *)orxBank_Allocate(sstBundle.pstRecordBank);
+    orxASSERT(pstRecord != orxNULL);
+    pstRecord->stNameID = _stNameID;
+    pstRecord->zName    = orxString_Duplicate(_zName);
+    pstRecord->dTime    = orxDOUBLE_0;
+    pstRecord->u32Order = orxU32_UNDEFINED;
+
+    // Stores it
+    *ppstRecord = pstRecord;
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_RecordOpen(orxSTRINGID _stNameID)
+{
+  BundleRecord *pstRecord;
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // First access?
+  if(((pstRecord = (BundleRecord *)orxHashTable_Get(sstBundle.pstRecordTable, _stNameID)) != orxNULL)
+  && (pstRecord->u32Order == orxU32_UNDEFINED))
+  {
+    // Records it
+    pstRecord->dTime    = orxSystem_GetSystemTime() - sstBundle.dRecordTime;
+    pstRecord->u32Order = sstBundle.u32RecordCount++;
+  }
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_SaveRecords()
+{
+  const orxSTRING zLocation;
+  orxHANDLE       hManifest;
+
+  // Opens manifest
+  if(((zLocation = orxResource_LocateInStorage(orxBUNDLE_KZ_RESOURCE_GROUP, orxRESOURCE_KZ_DEFAULT_STORAGE, sstBundle.zManifest)) != orxNULL)
+  && ((hManifest = orxResource_Open(zLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+  {
+    BundleRecord  **apstRecordList, *pstRecord;
+    orxU32          i, u32Count;
+
+    // Creates record list
+    apstRecordList = (BundleRecord **)orxMemory_Allocate((sstBundle.u32RecordCount + 1) * sizeof(BundleRecord *), orxMEMORY_TYPE_TEMP);
+    orxASSERT(apstRecordList != orxNULL);
+
+    // For all opened records
+    for(pstRecord = (BundleRecord *)orxBank_GetNext(sstBundle.pstRecordBank, orxNULL), u32Count = 0;
+        pstRecord != orxNULL;
+        pstRecord = (BundleRecord *)orxBank_GetNext(sstBundle.pstRecordBank, pstRecord))
+    {
+      if(pstRecord->u32Order != orxU32_UNDEFINED)
+      {
+        apstRecordList[u32Count++] = pstRecord;
+      }
+    }
+
+    // Sorts them by access order
+    qsort(apstRecordList, u32Count, sizeof(BundleRecord *), &orxBundle_CompareRecords);
+
+    // For all records
+    for(i = 0; i < u32Count; i++)
+    {
+      // Outputs it
+      orxResource_Print(hManifest, "%.6f %s\n", apstRecordList[i]->dTime, apstRecordList[i]->zName);
+    }
+
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG "Recorded " orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_RESET " resource accesses into " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET, u32Count, orxResource_GetPath(zLocation));
+
+    // Frees record list
+    orxMemory_Free(apstRecordList);
+
+    // Closes manifest
+    orxResource_Close(hManifest);
+  }
+  else
+  {
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Can't open manifest " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED ", access order is lost!" orxANSI_KZ_COLOR_RESET, sstBundle.zManifest);
+  }
+
+  // Done!
+  return;
+}
+
+static orxINLINE void orxBundle_ClearRecords()
+{
+  BundleRecord *pstRecord;
+
+  // For all records
+  for(pstRecord = (BundleRecord *)orxBank_GetNext(sstBundle.pstRecordBank, orxNULL);
+      pstRecord != orxNULL;
+      pstRecord = (BundleRecord *)orxBank_GetNext(sstBundle.pstRecordBank, pstRecord))
+  {
+    // Deletes its name
+    orxString_Delete(pstRecord->zName);
+  }
+
+  // Deletes record bank & table
+  orxBank_Delete(sstBundle.pstRecordBank);
+  sstBundle.pstRecordBank = orxNULL;
+  orxHashTable_Delete(sstBundle.pstRecordTable);
+  sstBundle.pstRecordTable = orxNULL;
+
+  // Deletes manifest name
+  orxString_Delete(sstBundle.zManifest);
+  sstBundle.zManifest = orxNULL;
+
+  // Done!
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxBundle_RecordParamHandler(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Not already recording?
+  if(sstBundle.pstRecordTable == orxNULL)
+  {
+    // Creates record table & bank
+    sstBundle.pstRecordTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxASSERT(sstBundle.pstRecordTable != orxNULL);
+    sstBundle.pstRecordBank = orxBank_Create(orxBUNDLE_KU32_TABLE_SIZE, sizeof(BundleRecord), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxASSERT(sstBundle.pstRecordBank != orxNULL);
+
+    // Stores manifest name
+    sstBundle.zManifest       = orxString_Duplicate((_u32ParamCount > 1) ? _azParams[1] : orxBUNDLE_KZ_DEFAULT_MANIFEST);
+    sstBundle.dRecordTime     = orxSystem_GetSystemTime();
+    sstBundle.u32RecordCount  = 0;
+
+    // Logs message
+    orxLOG(orxBUNDLE_KZ_LOG_TAG "Recording resource accesses into " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET, sstBundle.zManifest);
+  }
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static orxINLINE orxU32 orxBundle_GetDictionaryGroup(const orxBUNDLE_RESOURCE_REF *_pstResourceRef, const BundleDictionaryGroup *_astGroupList, orxU32 _u32GroupCount)
+{
+  const orxSTRING zName;
+  orxU32          i, u32NameLength, u32Result = 0;
+
+  // Gets name
+  zName         = orxString_GetFromID(_pstResourceRef->stNameID);
+  u32NameLength = orxString_GetLength(zName);
+
+  // For all groups
+  for(i = 0; i < _u32GroupCount; i++)
+  {
+    const orxSTRING zGroup;
+    orxU32          u32GroupLength;
+
+    // Gets it
+    zGroup          = _astGroupList[i].zName;
+    u32GroupLength  = orxString_GetLength(zGroup);
+
+    // Matches extension or resource group?
+    if(((*zGroup == '.') && (u32NameLength >= u32GroupLength) && (orxString_ICompare(zName + u32NameLength - u32GroupLength, zGroup) == 0))
+    || (orxString_ICompare(_pstResourceRef->zGroup, zGroup) == 0))
+    {
+      // Updates result
+      u32Result = i + 1;
+      break;
+    }
+  }
+
+  // Done!
+  return u32Result;
+}
+
+// Builds a shared dictionary out of the heads of all resources that belong to a dictionary group (LZ4 can't train one, but small text files mostly share their openings)
+static orxINLINE orxS32 orxBundle_BuildDictionary(orxBANK *_pstResourceBank, const BundleDictionaryGroup *_astGroupList, orxU32 _u32GroupCount, orxU8 *_pu8Dictionary)
+{
+  orxBUNDLE_RESOURCE_REF *pstResourceRef;
+  orxU32                  u32Count = 0, u32SampleSize;
+  orxS32                  s32Result = 0;
+
+  // For all refs
+  for(pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, orxNULL);
+      pstResourceRef != orxNULL;
+      pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, pstResourceRef))
+  {
+    // Gets its group
+    pstResourceRef->u32DictionaryGroup = orxBundle_GetDictionaryGroup(pstResourceRef, _astGroupList, _u32GroupCount);
+
+    // Found?
+    if(pstResourceRef->u32DictionaryGroup != 0)
+    {
+      // Updates count
+      u32Count++;
+    }
+  }
+
+  // Gets sample size
+  u32SampleSize = (u32Count != 0) ? orxMAX(orxBUNDLE_KU32_DICTIONARY_SIZE / u32Count, orxBUNDLE_KU32_DICTIONARY_SAMPLE) : 0;
+
+  // For all refs
+  for(pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, orxNULL);
+      (pstResourceRef != orxNULL) && (s32Result < orxBUNDLE_KU32_DICTIONARY_SIZE);
+      pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(_pstResourceBank, pstResourceRef))
+  {
+    // In a group?
+    if(pstResourceRef->u32DictionaryGroup != 0)
+    {
+      orxHANDLE hResource;
+
+      // Opens it
+      hResource = orxResource_Open(pstResourceRef->zLocation, orxFALSE);
+
+      // Success?
+      if(hResource != orxHANDLE_UNDEFINED)
+      {
+        orxS64 s64Size;
+
+        // Samples its head
+        s64Size = orxMIN((orxS64)u32SampleSize, orxMIN(pstResourceRef->s64FinalSize, (orxS64)(orxBUNDLE_KU32_DICTIONARY_SIZE - s32Result)));
+        s64Size = orxResource_Read(hResource, s64Size, _pu8Dictionary + s32Result, orxNULL, orxNULL);
+        if(s64Size > 0)
+        {
+          s32Result += (orxS32)s64Size;
+        }
 
-  u8Value = _u32Value & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u32Value >> 8) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u32Value >> 16) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u32Value >> 24) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
+        // Closes it
+        orxResource_Close(hResource);
+      }
+    }
+  }
 
   // Done!
-  return;
+  return s32Result;
 }
 
-static orxINLINE void orxResource_WriteU64(orxHANDLE _hResource, orxU64 _u64Value)
+static orxINLINE void orxBundle_ClearPrevious()
 {
-  orxU8 u8Value;
+  // Has previous ToC?
+  if(sstBundle.pstPreviousToC != orxNULL)
+  {
+    // Deletes it
+    orxBundle_DeleteToC(sstBundle.pstPreviousToC);
+    sstBundle.pstPreviousToC = orxNULL;
+  }
 
-  u8Value = _u64Value & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 8) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 16) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 24) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 32) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 40) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 48) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u8Value = (_u64Value >> 56) & 0xFF;
-  orxResource_Write(_hResource, 1, &u8Value, orxNULL, orxNULL);
+  // Has previous resource?
+  if(sstBundle.hPreviousResource != orxHANDLE_UNDEFINED)
+  {
+    // Closes it
+    orxResource_Close(sstBundle.hPreviousResource);
+    sstBundle.hPreviousResource = orxHANDLE_UNDEFINED;
+  }
 
   // Done!
   return;
 }
 
-static orxINLINE orxU32 orxResource_ReadU32(orxHANDLE _hResource)
+// Reads an unchanged payload back from the previous bundle
+static orxINLINE orxU8 *orxBundle_ReadPrevious(orxU32 _u32Index)
 {
-  orxU32  u32Result = 0;
-  orxU8   u8Value;
+  const BundleEntry  *pstEntry;
+  orxU8              *pu8Result;
 
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u32Result |= u8Value;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u32Result |= ((orxU32)u8Value) << 8;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u32Result |= ((orxU32)u8Value) << 16;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u32Result |= ((orxU32)u8Value) << 24;
+  // Gets entry
+  pstEntry = &(sstBundle.pstPreviousToC->astEntryList[_u32Index]);
+
+  // Allocates its payload
+  pu8Result = (orxU8 *)orxMemory_Allocate((orxU32)pstEntry->s64Size, orxMEMORY_TYPE_TEMP);
+  orxASSERT(pu8Result != orxNULL);
+
+  // Can't read it?
+  if((orxResource_Seek(sstBundle.hPreviousResource, pstEntry->s64Offset, orxSEEK_OFFSET_WHENCE_START) != pstEntry->s64Offset)
+  || (orxResource_Read(sstBundle.hPreviousResource, pstEntry->s64Size, pu8Result, orxNULL, orxNULL) != pstEntry->s64Size))
+  {
+    // Frees it
+    orxMemory_Free(pu8Result);
+    pu8Result = orxNULL;
+  }
 
   // Done!
-  return u32Result;
+  return pu8Result;
 }
 
-static orxINLINE orxU64 orxResource_ReadU64(orxHANDLE _hResource)
+// Keeps the previous output bundle open (the new one is written to a temporary location) so that unchanged payloads can be read back from it
+static orxINLINE void orxBundle_LoadPrevious(const orxSTRING _zLocation)
 {
-  orxU64  u64Result = 0;
-  orxU8   u8Value;
+  orxHANDLE hResource;
 
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= u8Value;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 8;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 16;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 24;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 32;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 40;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 48;
-  orxResource_Read(_hResource, 1, &u8Value, orxNULL, orxNULL);
-  u64Result |= ((orxU64)u8Value) << 56;
-
-  // Done!
-  return u64Result;
-}
+  // Clears previous bundle
+  orxBundle_ClearPrevious();
 
+  // Opens it
+  orxDEBUG_ENABLE_LEVEL(orxDEBUG_LEVEL_SYSTEM, orxFALSE);
+  hResource = orxResource_Open(_zLocation, orxFALSE);
 
-//! Code
+  // Success?
+  if(hResource != orxHANDLE_UNDEFINED)
+  {
+    BundleToC *pstToC;
 
-void orxFASTCALL orxBundle_CommandIsProcessing(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  // Updates result
-  _pstResult->bValue = orxBundle_IsProcessing();
+    // Loads its ToC, made with the same encryption key?
+    if(((pstToC = orxBundle_LoadToC(_zLocation, hResource)) != orxNULL)
+    && (pstToC->u32KeyCheck == orxBundle_GetKeyCheck(orxConfig_GetEncryptionKey())))
+    {
+      // Stores it
+      sstBundle.pstPreviousToC    = pstToC;
+      sstBundle.hPreviousResource = hResource;
 
-  // Done!
-  return;
-}
+      // Logs message
+      orxLOG(orxBUNDLE_KZ_LOG_TAG "Found previous bundle " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET " (" orxANSI_KZ_COLOR_FG_CYAN "%u" orxANSI_KZ_COLOR_RESET " resources), reusing unchanged payloads", orxResource_GetPath(_zLocation), pstToC->u32Count);
+    }
+    else
+    {
+      // Has ToC?
+      if(pstToC != orxNULL)
+      {
+        // Deletes it
+        orxBundle_DeleteToC(pstToC);
+      }
 
-void orxFASTCALL orxBundle_CommandGetOutputName(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
-{
-  // Updates result
-  _pstResult->zValue = orxBundle_GetOutputName();
+      // Closes it
+      orxResource_Close(hResource);
+    }
+  }
+  orxDEBUG_ENABLE_LEVEL(orxDEBUG_LEVEL_SYSTEM, orxTRUE);
 
   // Done!
   return;
 }
 
-static orxINLINE void orxBundle_ClearResourceTable(orxHASHTABLE *_pstResourceTable)
+// Opens the output bundle at a temporary location, next to its final one
+static orxINLINE orxHANDLE orxBundle_OpenOutput(const orxSTRING _zLocation)
 {
-  orxHANDLE hIterator, hResource;
+  orxHANDLE hResult;
 
-  // For all resources
-  for(hIterator = orxHashTable_GetNext(_pstResourceTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&hResource);
-      hIterator != orxHANDLE_UNDEFINED;
-      hIterator = orxHashTable_GetNext(_pstResourceTable, hIterator, orxNULL, (void **)&hResource))
-  {
-    // Closes it
-    orxResource_Close(hResource);
-  }
+  // Stores both locations
+  orxString_NPrint(sstBundle.acOutputLocation, sizeof(sstBundle.acOutputLocation), "%s", _zLocation);
+  orxString_NPrint(sstBundle.acTempLocation, sizeof(sstBundle.acTempLocation), "%s%s", _zLocation, orxBUNDLE_KZ_TEMP_EXTENSION);
 
-  // Clears table
-  orxHashTable_Clear(_pstResourceTable);
+  // Opens temporary output
+  hResult = orxResource_Open(sstBundle.acTempLocation, orxTRUE);
 
   // Done!
-  return;
+  return hResult;
 }
 
-static orxINLINE void orxBundle_ClearResourceTables()
+// Replaces the previous output bundle with the temporary one (when committing) or discards the latter
+static orxINLINE void orxBundle_CloseOutput(orxHANDLE _hOutput, orxBOOL _bCommit)
 {
-  orxU32 i;
-
-  // Checks
-  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+  // Closes it
+  orxResource_Close(_hOutput);
 
-  // For all resource tables
-  for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.apstResourceTableList); i++)
+  // Commit?
+  if(_bCommit != orxFALSE)
   {
-    // Clears it
-    orxBundle_ClearResourceTable(sstBundle.apstResourceTableList[i]);
-  }
-
-  // Done!
-  return;
-}
+    const orxSTRING zOutputPath;
 
-static orxINLINE void orxBundle_ClearToCTable()
-{
-  orxHANDLE     hIterator;
-  orxHASHTABLE *pstToC;
+    // Gets final path
+    zOutputPath = orxResource_GetPath(sstBundle.acOutputLocation);
 
-  // Checks
-  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+    // Removes previous bundle, if any
+    if(orxFile_Exists(zOutputPath) != orxFALSE)
+    {
+      orxFile_Remove(zOutputPath);
+    }
 
-  // For all ToCs
-  for(hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstToC);
-      hIterator != orxHANDLE_UNDEFINED;
-      hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, hIterator, orxNULL, (void **)&pstToC))
-  {
-    // Valid?
-    if(pstToC != orxNULL)
+    // Can't move new one over it?
+    if(rename(orxResource_GetPath(sstBundle.acTempLocation), zOutputPath) != 0)
     {
-      // Deletes it
-      orxHashTable_Delete(pstToC);
+      // Logs message
+      orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Couldn't rename " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED " to " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED ", new bundle left in place!" orxANSI_KZ_COLOR_RESET, orxResource_GetPath(sstBundle.acTempLocation), zOutputPath);
     }
   }
+  else
+  {
+    // Deletes temporary output
+    orxResource_Delete(sstBundle.acTempLocation);
+  }
 
-  // Clears ToC table
-  orxHashTable_Clear(sstBundle.pstToCTable);
+  // Clears locations
+  sstBundle.acOutputLocation[0] = sstBundle.acTempLocation[0] = orxCHAR_NULL;
 
   // Done!
   return;
@@ -323,8 +2124,11 @@ static orxSTATUS orxFASTCALL orxBundle_BundleParamHandler(orxU32 _u32ParamCount,
       // Success?
       if(zLocation != orxNULL)
       {
-        // Opens resource
-        sstBundle.hResource = orxResource_Open(zLocation, orxTRUE);
+        // Loads previous bundle, if any
+        orxBundle_LoadPrevious(zLocation);
+
+        // Opens output
+        sstBundle.hResource = orxBundle_OpenOutput(zLocation);
 
         // Success?
         if(sstBundle.hResource != orxHANDLE_UNDEFINED)
@@ -365,6 +2169,9 @@ static orxSTATUS orxFASTCALL orxBundle_BundleParamHandler(orxU32 _u32ParamCount,
       // Clears ToC table
       orxBundle_ClearToCTable();
 
+      // Clears cache
+      orxBundle_ClearCache();
+
       // Syncs all groups
       orxResource_Sync(orxNULL);
 
@@ -392,26 +2199,6 @@ static orxSTATUS orxFASTCALL orxBundle_BundleParamHandler(orxU32 _u32ParamCount,
   return eResult;
 }
 
-static orxINLINE const orxSTRING orxBundle_GetHumanReadableSize(orxS64 _s64Size, orxU32 _u32Decimals)
-{
-  static const orxSTRING  sazUnitList[] = {"B", "KB", "MB", "GB", "TB"};
-  static orxCHAR          sacBuffer[16];
-  orxU32                  u32UnitIndex;
-  orxFLOAT                fSize;
-
-  /* Finds best unit */
-  for(u32UnitIndex = 0, fSize = orxS2F(_s64Size);
-      (u32UnitIndex < orxARRAY_GET_ITEM_COUNT(sazUnitList) - 1) && (fSize > orx2F(1024.0f));
-      u32UnitIndex++, fSize *= orx2F(1.0f/1024.0f))
-    ;
-
-  // Prints it
-  orxString_NPrint(sacBuffer, sizeof(sacBuffer), "%.*g%s", orxF2U(log10f(fSize) + _u32Decimals + 1), fSize, sazUnitList[u32UnitIndex]);
-
-  // Done!
-  return sacBuffer;
-}
-
 static orxINLINE orxSTATUS orxBundle_Process()
 {
   orxHANDLE hOutput;
@@ -432,16 +2219,6 @@ static orxINLINE orxSTATUS orxBundle_Process()
   // Success?
   if(hOutput != orxHANDLE_UNDEFINED)
   {
-    typedef struct orxBUNDLE_RESOURCE_REF
-    {
-      orxSTRINGID     stNameID;
-      const orxSTRING zLocation;
-      const orxSTRING zGroup;
-      const orxSTRING zRule;
-      orxS64          s64Size;
-      orxS64          s64FinalSize;
-    } orxBUNDLE_RESOURCE_REF;
-
     struct
     {
       const orxSTRING zKey;
@@ -454,9 +2231,14 @@ static orxINLINE orxSTATUS orxBundle_Process()
     };
 
     orxDOUBLE     dBeginTime, dEndTime;
+    orxHANDLE     hPayload, hBlob = orxHANDLE_UNDEFINED;
+    orxCHAR       acManifest[orxBUNDLE_KU32_LOCATION_SIZE];
+    orxS64        s64PrefetchSize;
+    BundleDictionaryGroup astDictionaryGroupList[orxBUNDLE_KU32_DICTIONARY_GROUPS];
+    orxU32        u32DictionaryGroupCount;
     orxBANK      *pstResourceBank;
     orxHASHTABLE *pstRuleTable, *pstDiscoveryTable;
-    orxU32        i, j, iCount, jCount, u32GroupCount, u32ConfigHistoryExtensionLength;
+    orxU32        i, j, iCount, jCount, u32GroupCount, u32ConfigHistoryExtensionLength, u32Alignment;
     orxBOOL       bBinary;
 
     // Gets begin time
@@ -478,6 +2260,41 @@ static orxINLINE orxSTATUS orxBundle_Process()
     // Pushes bundle section
     orxConfig_PushSection(orxBUNDLE_KZ_CONFIG_SECTION);
 
+    // Gets payload alignment
+    u32Alignment = orxBundle_GetAlignment();
+
+    // Embedded output in binary mode?
+    if((bBinary == orxFALSE)
+    && (orxString_ICompare(orxConfig_GetString(orxBUNDLE_KZ_CONFIG_EMBED_MODE), orxBUNDLE_KZ_EMBED_MODE_BINARY) == 0))
+    {
+      // Opens blob resource
+      hBlob = orxResource_Open(orxResource_LocateInStorage(orxBUNDLE_KZ_RESOURCE_GROUP, orxNULL, orxBUNDLE_KZ_INCLUDE_PATH orxBUNDLE_KZ_INCLUDE_FILENAME orxBUNDLE_KZ_BLOB_EXTENSION), orxTRUE);
+
+      // Failure?
+      if(hBlob == orxHANDLE_UNDEFINED)
+      {
+        // Logs message
+        orxLOG(orxBUNDLE_KZ_LOG_TAG orxANSI_KZ_COLOR_FG_RED "Can't open blob file " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_FG_RED ", using hex mode instead" orxANSI_KZ_COLOR_RESET, orxBUNDLE_KZ_INCLUDE_PATH orxBUNDLE_KZ_INCLUDE_FILENAME orxBUNDLE_KZ_BLOB_EXTENSION);
+      }
+    }
+
+    // Gets payload output
+    hPayload = (bBinary != orxFALSE) ? hOutput : hBlob;
+
+    // Gets access order manifest & prefetch size
+    orxString_NPrint(acManifest, sizeof(acManifest), "%s", orxConfig_GetString(orxBUNDLE_KZ_CONFIG_MANIFEST));
+    s64PrefetchSize = orxConfig_HasValue(orxBUNDLE_KZ_CONFIG_PREFETCH_SIZE) ? (orxS64)orxConfig_GetU64(orxBUNDLE_KZ_CONFIG_PREFETCH_SIZE) : orxBUNDLE_KU64_PREFETCH_SIZE;
+
+    // Gets dictionary groups (binary bundles only)
+    u32DictionaryGroupCount = (bBinary != orxFALSE) ? orxMIN((orxU32)orxConfig_GetListCount(orxBUNDLE_KZ_CONFIG_DICTIONARY_LIST), orxBUNDLE_KU32_DICTIONARY_GROUPS) : 0;
+    for(i = 0; i < u32DictionaryGroupCount; i++)
+    {
+      astDictionaryGroupList[i].zName         = orxConfig_GetListString(orxBUNDLE_KZ_CONFIG_DICTIONARY_LIST, (orxS32)i);
+      astDictionaryGroupList[i].s64FinalSize  = 0;
+      astDictionaryGroupList[i].s64PlainSize  = 0;
+      astDictionaryGroupList[i].s64Size       = 0;
+    }
+
     // For all rule lists
     for(i = 0, iCount = orxARRAY_GET_ITEM_COUNT(astRuleInfoList); i < iCount; i++)
     {
@@ -656,8 +2473,14 @@ static orxINLINE orxSTATUS orxBundle_Process()
                       pstResourceRef->zLocation       = zLocation;
                       pstResourceRef->zGroup          = zGroup;
                       pstResourceRef->zRule           = zRule;
+                      pstResourceRef->s64Offset       = 0;
                       pstResourceRef->s64Size         = 0;
                       pstResourceRef->s64FinalSize    = s64Size;
+                      pstResourceRef->u64Hash         = 0;
+                      pstResourceRef->u32Flags        = orxBUNDLE_KU32_ENTRY_FLAG_NONE;
+                      pstResourceRef->u32DataIndex    = 0;
+                      pstResourceRef->u32Order        = orxU32_UNDEFINED;
+                      pstResourceRef->u32DictionaryGroup = 0;
                     }
                   }
                   else
@@ -676,18 +2499,88 @@ static orxINLINE orxSTATUS orxBundle_Process()
       }
     }
 
+    // Has manifest?
+    if((acManifest[0] != orxCHAR_NULL) && (orxBank_GetCount(pstResourceBank) != 0))
+    {
+      // Lays out resources in recorded access order
+      pstResourceBank = orxBundle_SortResources(pstResourceBank, acManifest, s64PrefetchSize);
+    }
+
     // Has data?
     if(orxBank_GetCount(pstResourceBank) != 0)
     {
       orxBUNDLE_RESOURCE_REF *pstResourceRef, *pstNextResourceRef;
+      orxHASHTABLE           *pstContentTable;
+      LZ4_streamHC_t         *pstStream = orxNULL;
+      orxU8                  *pu8Dictionary = orxNULL;
+      orxS64                  s64Offset = 0;
+      orxS32                  s32DictionarySize = 0;
       orxU32                  u32HeaderSize = 0, u32ResourceIndex;
 
+      // Creates content table
+      pstContentTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+      orxASSERT(pstContentTable != orxNULL);
+
+      // Has dictionary groups?
+      if(u32DictionaryGroupCount != 0)
+      {
+        // Builds dictionary
+        pu8Dictionary = (orxU8 *)orxMemory_Allocate(orxBUNDLE_KU32_DICTIONARY_SIZE, orxMEMORY_TYPE_TEMP);
+        orxASSERT(pu8Dictionary != orxNULL);
+        s32DictionarySize = orxBundle_BuildDictionary(pstResourceBank, astDictionaryGroupList, u32DictionaryGroupCount, pu8Dictionary);
+
+        // Success?
+        if(s32DictionarySize > 0)
+        {
+          // Adds its ref
+          pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_Allocate(pstResourceBank);
+          orxASSERT(pstResourceRef != orxNULL);
+          orxMemory_Zero(pstResourceRef, sizeof(orxBUNDLE_RESOURCE_REF));
+          pstResourceRef->stNameID      = orxString_GetID(orxBUNDLE_KZ_DICTIONARY_NAME);
+          pstResourceRef->zGroup        = orxBUNDLE_KZ_RESOURCE_GROUP;
+          pstResourceRef->s64Size       = (orxS64)s32DictionarySize;
+          pstResourceRef->s64FinalSize  = (orxS64)s32DictionarySize;
+          pstResourceRef->u64Hash       = orxBundle_Hash(pu8Dictionary, (orxS64)s32DictionarySize);
+          pstResourceRef->u32Flags      = orxBUNDLE_KU32_ENTRY_FLAG_STORED | orxBUNDLE_KU32_ENTRY_FLAG_DICTIONARY;
+          pstResourceRef->u32Order      = orxU32_UNDEFINED;
+
+          // Creates compression stream
+          pstStream = LZ4_createStreamHC();
+          orxASSERT(pstStream != orxNULL);
+
+          // Logs message
+          orxLOG(orxBUNDLE_KZ_LOG_TAG "Built compression dictionary " orxANSI_KZ_COLOR_FG_GREEN "(%s)" orxANSI_KZ_COLOR_RESET, orxBundle_GetHumanReadableSize((orxS64)s32DictionarySize, 2));
+        }
+      }
+
       // Binary output?
       if(bBinary != orxFALSE)
       {
         // Skips header size
         u32HeaderSize = orxBUNDLE_KU32_HEADER_INTRO_SIZE + orxBank_GetCount(pstResourceBank) * orxBUNDLE_KU32_HEADER_ENTRY_SIZE;
-        orxResource_Seek(hOutput, u32HeaderSize, orxSEEK_OFFSET_WHENCE_START);
+        s64Offset     = (orxS64)u32HeaderSize;
+
+        // Has dictionary?
+        if(pstStream != orxNULL)
+        {
+          orxU8 *pu8Payload;
+
+          // Encrypts a copy
+          pu8Payload = (orxU8 *)orxMemory_Allocate((orxU32)s32DictionarySize, orxMEMORY_TYPE_TEMP);
+          orxASSERT(pu8Payload != orxNULL);
+          orxMemory_Copy(pu8Payload, pu8Dictionary, (orxU32)s32DictionarySize);
+          orxBundle_Crypt(pu8Payload, (orxS64)s32DictionarySize, orxConfig_GetEncryptionKey());
+
+          // Outputs it
+          s64Offset = orxALIGN(s64Offset, (orxS64)u32Alignment);
+          orxResource_Seek(hOutput, s64Offset, orxSEEK_OFFSET_WHENCE_START);
+          orxResource_Write(hOutput, (orxS64)s32DictionarySize, pu8Payload, orxNULL, orxNULL);
+          pstResourceRef->s64Offset = s64Offset;
+          s64Offset                += (orxS64)s32DictionarySize;
+
+          // Frees copy
+          orxMemory_Free(pu8Payload);
+        }
       }
 
       // For all refs
@@ -701,6 +2594,13 @@ static orxINLINE orxSTATUS orxBundle_Process()
         // Gets next resource ref
         pstNextResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, pstResourceRef);
 
+        // Dictionary?
+        if(orxFLAG_TEST(pstResourceRef->u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_DICTIONARY))
+        {
+          // Already written
+          continue;
+        }
+
         // Allocates buffer
         pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)(pstResourceRef->s64FinalSize), orxMEMORY_TYPE_TEMP);
         orxASSERT(pu8Buffer != orxNULL);
@@ -733,96 +2633,223 @@ static orxINLINE orxSTATUS orxBundle_Process()
         if((hResource != orxHANDLE_UNDEFINED)
         && (orxResource_Read(hResource, pstResourceRef->s64FinalSize, pu8Buffer, orxNULL, orxNULL) == pstResourceRef->s64FinalSize))
         {
-          orxS32  s32CompressedSize;
-          orxU8  *pu8CompressedBuffer;
+          const orxBUNDLE_RESOURCE_REF *pstOriginalRef;
 
-          // Gets compressed buffer size
-          s32CompressedSize = LZ4_compressBound((orxS32)pstResourceRef->s64FinalSize);
+          // Computes content hash
+          pstResourceRef->u64Hash = orxBundle_Hash(pu8Buffer, pstResourceRef->s64FinalSize);
 
-          // Allocates buffer
-          pu8CompressedBuffer = (orxU8 *)orxMemory_Allocate(s32CompressedSize, orxMEMORY_TYPE_TEMP);
-          orxASSERT(pu8CompressedBuffer != orxNULL);
-
-          // Compresses it
-          s32CompressedSize = (orxS32)LZ4_compress_HC((const char *)pu8Buffer, (char *)pu8CompressedBuffer, (int)pstResourceRef->s64FinalSize, (int)s32CompressedSize, LZ4HC_CLEVEL_MAX);
+          // Same content already bundled?
+          if(((pstOriginalRef = (const orxBUNDLE_RESOURCE_REF *)orxHashTable_Get(pstContentTable, pstResourceRef->u64Hash)) != orxNULL)
+          && (pstOriginalRef->s64FinalSize == pstResourceRef->s64FinalSize)
+          && (orxBundle_IsSameResource(pstOriginalRef->zLocation, pu8Buffer, pstResourceRef->s64FinalSize) != orxFALSE))
+          {
+            // Shares its payload
+            pstResourceRef->s64Offset     = pstOriginalRef->s64Offset;
+            pstResourceRef->s64Size       = pstOriginalRef->s64Size;
+            pstResourceRef->u32DataIndex  = pstOriginalRef->u32DataIndex;
+            pstResourceRef->u32Flags     |= (pstOriginalRef->u32Flags & (orxBUNDLE_KU32_ENTRY_FLAG_STORED | orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY)) | orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE;
 
-          // Success?
-          if(s32CompressedSize > 0)
+            // Logs message
+            orxLOG(orxBUNDLE_KZ_LOG_TAG "Sharing payload of " orxBUNDLE_KZ_RESOURCE_FORMAT, pstOriginalRef->zGroup, orxString_GetFromID(pstOriginalRef->stNameID));
+          }
+          else
           {
-            const orxSTRING zKey;
-            const orxU8    *pu8Key;
-            orxU8          *pu8Data;
+            orxU8  *pu8Payload = orxNULL, *pu8CompressedBuffer = orxNULL;
+            orxU32  u32PreviousIndex;
+
+            // Unchanged since previous bundle?
+            if((sstBundle.pstPreviousToC != orxNULL)
+            && ((u32PreviousIndex = orxBundle_FindEntry(sstBundle.pstPreviousToC, pstResourceRef->stNameID)) != orxU32_UNDEFINED)
+            && (sstBundle.pstPreviousToC->astEntryList[u32PreviousIndex].u64Hash == pstResourceRef->u64Hash)
+            && (sstBundle.pstPreviousToC->astEntryList[u32PreviousIndex].s64FinalSize == pstResourceRef->s64FinalSize)
+            && (!orxFLAG_TEST(sstBundle.pstPreviousToC->astEntryList[u32PreviousIndex].u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY))
+            && ((pu8CompressedBuffer = orxBundle_ReadPrevious(u32PreviousIndex)) != orxNULL))
+            {
+              const BundleEntry *pstPreviousEntry;
 
-            // Gets encryption key
-            zKey = orxConfig_GetEncryptionKey();
+              // Gets previous entry
+              pstPreviousEntry = &(sstBundle.pstPreviousToC->astEntryList[u32PreviousIndex]);
 
-            // Encrypts data
-            for(pu8Key = (const orxU8 *)zKey, pu8Data = pu8CompressedBuffer;
-                pu8Data < pu8CompressedBuffer + s32CompressedSize;
-                pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Data++)
-            {
-              *pu8Data ^= *pu8Key;
-            }
+              // Reuses its payload
+              pu8Payload                = pu8CompressedBuffer;
+              pstResourceRef->s64Size   = pstPreviousEntry->s64Size;
+              pstResourceRef->u32Flags |= pstPreviousEntry->u32Flags & orxBUNDLE_KU32_ENTRY_FLAG_STORED;
 
-            // Binary output?
-            if(bBinary != orxFALSE)
-            {
-              // Outputs resource
-              orxResource_Write(hOutput, (orxS64)s32CompressedSize, pu8CompressedBuffer, orxNULL, orxNULL);
+              // Logs message
+              orxLOG(orxBUNDLE_KZ_LOG_TAG "Unchanged, reusing previous payload");
             }
             else
             {
-              orxS32 s32Index;
+              orxS32 s32CompressedSize;
 
-              // Outputs structure header
-              orxResource_Print(hOutput, "static const orxU8 BundleData0x%x[] =\r\n{", u32ResourceIndex);
+              // Gets compressed buffer size
+              s32CompressedSize = LZ4_compressBound((orxS32)pstResourceRef->s64FinalSize);
 
-              // For all bytes
-              for(s32Index = 0; s32Index < s32CompressedSize; s32Index++)
-              {
-                static const orxCHAR  acDigits[]      = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
-                static orxCHAR        acByteBuffer[]  = {' ', '0', 'x', '0', '0', ','};
-                orxU8                 u8Byte;
+              // Allocates buffer
+              pu8CompressedBuffer = (orxU8 *)orxMemory_Allocate(s32CompressedSize, orxMEMORY_TYPE_TEMP);
+              orxASSERT(pu8CompressedBuffer != orxNULL);
 
-                // New line?
-                if((s32Index % orxBUNDLE_KU32_LINE_LENGTH) == 0)
+              // Compresses it
+              s32CompressedSize = (orxS32)LZ4_compress_HC((const char *)pu8Buffer, (char *)pu8CompressedBuffer, (int)pstResourceRef->s64FinalSize, (int)s32CompressedSize, LZ4HC_CLEVEL_MAX);
+
+              // In a dictionary group?
+              if((s32CompressedSize > 0) && (pstStream != orxNULL) && (pstResourceRef->u32DictionaryGroup != 0))
+              {
+                BundleDictionaryGroup  *pstGroup;
+                orxU8                  *pu8DictionaryBuffer;
+                orxS32                  s32DictionaryCompressedSize;
+
+                // Gets its group
+                pstGroup = &astDictionaryGroupList[pstResourceRef->u32DictionaryGroup - 1];
+
+                // Compresses it with dictionary
+                s32DictionaryCompressedSize = LZ4_compressBound((orxS32)pstResourceRef->s64FinalSize);
+                pu8DictionaryBuffer = (orxU8 *)orxMemory_Allocate(s32DictionaryCompressedSize, orxMEMORY_TYPE_TEMP);
+                orxASSERT(pu8DictionaryBuffer != orxNULL);
+                LZ4_resetStreamHC_fast(pstStream, LZ4HC_CLEVEL_MAX);
+                LZ4_loadDictHC(pstStream, (const char *)pu8Dictionary, (int)s32DictionarySize);
+                s32DictionaryCompressedSize = (orxS32)LZ4_compress_HC_continue(pstStream, (const char *)pu8Buffer, (char *)pu8DictionaryBuffer, (int)pstResourceRef->s64FinalSize, (int)s32DictionaryCompressedSize);
+
+                // Updates group stats
+                pstGroup->s64FinalSize += pstResourceRef->s64FinalSize;
+                pstGroup->s64PlainSize += orxMIN((orxS64)s32CompressedSize, pstResourceRef->s64FinalSize);
+
+                // Better?
+                if((s32DictionaryCompressedSize > 0) && (s32DictionaryCompressedSize < s32CompressedSize))
                 {
-                  // Outputs it
-                  orxResource_Print(hOutput, "\r\n ");
+                  // Uses it
+                  orxMemory_Free(pu8CompressedBuffer);
+                  pu8CompressedBuffer       = pu8DictionaryBuffer;
+                  s32CompressedSize         = s32DictionaryCompressedSize;
+                  pstResourceRef->u32Flags |= orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY;
+                }
+                else
+                {
+                  // Frees it
+                  orxMemory_Free(pu8DictionaryBuffer);
                 }
 
-                // Outputs byte
-                u8Byte          = pu8CompressedBuffer[s32Index];
-                acByteBuffer[3] = acDigits[u8Byte >> 4];
-                acByteBuffer[4] = acDigits[u8Byte & 0x0F];
-                orxResource_Write(hOutput, sizeof(acByteBuffer), acByteBuffer, orxNULL, orxNULL);
+                // Updates group stats
+                pstGroup->s64Size += orxMIN((orxS64)s32CompressedSize, pstResourceRef->s64FinalSize);
               }
 
-              // Outputs structure footer
-              if(s32Index > 0)
+              // Success?
+              if(s32CompressedSize > 0)
               {
-                orxResource_Seek(hOutput, -1, orxSEEK_OFFSET_WHENCE_CURRENT);
+                // Not worth compressing?
+                if((orxS64)s32CompressedSize >= pstResourceRef->s64FinalSize)
+                {
+                  // Stores it as-is
+                  pu8Payload                = pu8Buffer;
+                  pstResourceRef->s64Size   = pstResourceRef->s64FinalSize;
+                  pstResourceRef->u32Flags  = (pstResourceRef->u32Flags & ~orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY) | orxBUNDLE_KU32_ENTRY_FLAG_STORED;
+                }
+                else
+                {
+                  // Stores compressed version
+                  pu8Payload                = pu8CompressedBuffer;
+                  pstResourceRef->s64Size   = (orxS64)s32CompressedSize;
+                }
+
+                // Encrypts data
+                orxBundle_Crypt(pu8Payload, pstResourceRef->s64Size, orxConfig_GetEncryptionKey());
               }
-              orxResource_Print(hOutput, "\r\n};\r\n\r\n");
             }
 
-            // Updates resource index
-            u32ResourceIndex++;
+            // Success?
+            if(pu8Payload != orxNULL)
+            {
+              // Binary payload output?
+              if(hPayload != orxHANDLE_UNDEFINED)
+              {
+                // Aligns payload
+                s64Offset = orxALIGN(s64Offset, (orxS64)u32Alignment);
 
-            // Updates size
-            pstResourceRef->s64Size = (orxS64)s32CompressedSize;
-          }
-          else
-          {
-            // Logs message
-            orxLOG(orxBUNDLE_KZ_LOG_TAG "Failure, skipping!");
+                // Outputs resource
+                orxResource_Seek(hPayload, s64Offset, orxSEEK_OFFSET_WHENCE_START);
+                orxResource_Write(hPayload, pstResourceRef->s64Size, pu8Payload, orxNULL, orxNULL);
 
-            // Removes it
-            orxBank_Free(pstResourceBank, pstResourceRef);
-          }
+                // Updates offsets
+                pstResourceRef->s64Offset = s64Offset;
+                s64Offset                += pstResourceRef->s64Size;
+              }
+              else
+              {
+                static const orxCHAR  acDigits[] = {'0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'a', 'b', 'c', 'd', 'e', 'f'};
+                orxCHAR               acBuffer[orxBUNDLE_KU32_BUFFER_SIZE];
+                orxS64                s64Index;
+                orxU32                u32Length;
+
+                // Outputs structure header
+                u32Length = orxString_NPrint(acBuffer, sizeof(acBuffer), "static const orxU8 BundleData0x%x[] =\r\n{", u32ResourceIndex);
+
+                // For all bytes
+                for(s64Index = 0; s64Index < pstResourceRef->s64Size; s64Index++)
+                {
+                  orxU8 u8Byte;
+
+                  // Buffer full?
+                  if(u32Length > sizeof(acBuffer) - 16)
+                  {
+                    // Flushes it
+                    orxResource_Write(hOutput, u32Length, acBuffer, orxNULL, orxNULL);
+                    u32Length = 0;
+                  }
+
+                  // New line?
+                  if((s64Index % orxBUNDLE_KU32_LINE_LENGTH) == 0)
+                  {
+                    // Outputs it
+                    acBuffer[u32Length++] = '\r';
+                    acBuffer[u32Length++] = '\n';
+                    acBuffer[u32Length++] = ' ';
+                  }
+
+                  // Outputs byte
+                  u8Byte                = pu8Payload[s64Index];
+                  acBuffer[u32Length++] = ' ';
+                  acBuffer[u32Length++] = '0';
+                  acBuffer[u32Length++] = 'x';
+                  acBuffer[u32Length++] = acDigits[u8Byte >> 4];
+                  acBuffer[u32Length++] = acDigits[u8Byte & 0x0F];
+                  acBuffer[u32Length++] = ',';
+                }
+
+                // Removes last separator
+                if(s64Index > 0)
+                {
+                  u32Length--;
+                }
+
+                // Outputs structure footer
+                u32Length += orxString_NPrint(acBuffer + u32Length, sizeof(acBuffer) - u32Length, "\r\n};\r\n\r\n");
+                orxResource_Write(hOutput, u32Length, acBuffer, orxNULL, orxNULL);
+              }
+
+              // Stores its data index
+              pstResourceRef->u32DataIndex = u32ResourceIndex;
+
+              // Registers its content
+              orxHashTable_Set(pstContentTable, pstResourceRef->u64Hash, pstResourceRef);
 
-          // Frees buffer
-          orxMemory_Free(pu8CompressedBuffer);
+              // Updates resource index
+              u32ResourceIndex++;
+            }
+            else
+            {
+              // Logs message
+              orxLOG(orxBUNDLE_KZ_LOG_TAG "Failure, skipping!");
+
+              // Removes it
+              orxBank_Free(pstResourceBank, pstResourceRef);
+            }
+
+            // Frees buffer
+            if(pu8CompressedBuffer != orxNULL)
+            {
+              orxMemory_Free(pu8CompressedBuffer);
+            }
+          }
         }
         else
         {
@@ -843,6 +2870,21 @@ static orxINLINE orxSTATUS orxBundle_Process()
         }
       }
 
+      // Deletes content table
+      orxHashTable_Delete(pstContentTable);
+
+      // Deletes compression stream
+      if(pstStream != orxNULL)
+      {
+        LZ4_freeStreamHC(pstStream);
+      }
+
+      // Frees dictionary
+      if(pu8Dictionary != orxNULL)
+      {
+        orxMemory_Free(pu8Dictionary);
+      }
+
       // Still has data?
       if(orxBank_GetCount(pstResourceBank) != 0)
       {
@@ -853,33 +2895,73 @@ static orxINLINE orxSTATUS orxBundle_Process()
         // Binary output?
         if(bBinary != orxFALSE)
         {
-          // Inits header
-          orxResource_Seek(hOutput, 0, orxSEEK_OFFSET_WHENCE_START);
-          orxResource_Print(hOutput, orxBUNDLE_KZ_BINARY_TAG);
-          orxResource_WriteU32(hOutput, orxBank_GetCount(pstResourceBank));
+          orxU8 *pu8Header, *pu8Entry;
+
+          // Allocates header
+          pu8Header = (orxU8 *)orxMemory_Allocate(u32HeaderSize, orxMEMORY_TYPE_TEMP);
+          orxASSERT(pu8Header != orxNULL);
+          orxMemory_Zero(pu8Header, u32HeaderSize);
+
+          // Inits intro
+          orxMemory_Copy(pu8Header, orxBUNDLE_KZ_BINARY_TAG, 4);
+          orxBundle_SetU32(pu8Header + 4, orxBank_GetCount(pstResourceBank));
+          orxBundle_SetU32(pu8Header + 8, u32Alignment);
+          orxBundle_SetU32(pu8Header + 12, orxBundle_GetKeyCheck(orxConfig_GetEncryptionKey()));
 
           // For all refs
-          for(pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, orxNULL), u32ResourceIndex = 0;
+          for(pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, orxNULL), u32ResourceIndex = 0, pu8Entry = pu8Header + orxBUNDLE_KU32_HEADER_INTRO_SIZE;
               pstResourceRef != orxNULL;
-              pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, pstResourceRef), u32ResourceIndex++)
+              pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, pstResourceRef), u32ResourceIndex++, pu8Entry += orxBUNDLE_KU32_HEADER_ENTRY_SIZE)
           {
-            // Valid?
-            if(pstResourceRef->s64Size > 0)
+            // Writes its header entry
+            orxBundle_SetU64(pu8Entry, (orxU64)pstResourceRef->stNameID);
+            orxBundle_SetU64(pu8Entry + 8, (orxU64)pstResourceRef->s64Offset);
+            orxBundle_SetU64(pu8Entry + 8 + 8, (orxU64)pstResourceRef->s64Size);
+            orxBundle_SetU64(pu8Entry + 8 + 8 + 8, (orxU64)pstResourceRef->s64FinalSize);
+            orxBundle_SetU64(pu8Entry + 8 + 8 + 8 + 8, pstResourceRef->u64Hash);
+            orxBundle_SetU32(pu8Entry + 8 + 8 + 8 + 8 + 8, pstResourceRef->u32Flags);
+
+            // Updates sizes
+            if(!orxFLAG_TEST(pstResourceRef->u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE))
             {
-              //  Writes its header entry
-              orxResource_WriteU64(hOutput, (orxU64)pstResourceRef->stNameID);
-              orxResource_WriteU32(hOutput, u32HeaderSize + (orxU32)s64Size);
-              orxResource_WriteU32(hOutput, (orxU32)pstResourceRef->s64Size);
-              orxResource_WriteU32(hOutput, (orxU32)pstResourceRef->s64FinalSize);
-
-              // Updates sizes
-              s64Size      += pstResourceRef->s64Size;
-              s64FinalSize += pstResourceRef->s64FinalSize;
+              s64Size += pstResourceRef->s64Size;
             }
+            s64FinalSize += pstResourceRef->s64FinalSize;
           }
+
+          // Outputs header
+          orxResource_Seek(hOutput, 0, orxSEEK_OFFSET_WHENCE_START);
+          orxResource_Write(hOutput, (orxS64)(pu8Entry - pu8Header), pu8Header, orxNULL, orxNULL);
+
+          // Frees header
+          orxMemory_Free(pu8Header);
         }
         else
         {
+          // Binary payloads?
+          if(hBlob != orxHANDLE_UNDEFINED)
+          {
+            // Outputs blob declaration: #embed when available, assembler's .incbin otherwise
+            // The blob sits next to the generated file and is referenced by its bare name (nothing to escape), .incbin looks it up in the assembler's include paths (-Wa,-I, see orxBUNDLE_KZ_CONFIG_EMBED_MODE)
+            orxResource_Print(hOutput,
+                              "#if defined(__has_embed)\r\n"
+                              "alignas(%u) static const orxU8 sau8BundleBlob[] =\r\n"
+                              "{\r\n"
+                              "#embed \"" orxBUNDLE_KZ_INCLUDE_FILENAME orxBUNDLE_KZ_BLOB_EXTENSION "\"\r\n"
+                              "};\r\n"
+                              "#elif defined(__orxGCC__) || defined(__orxLLVM__)\r\n"
+                              "#if defined(__orxMAC__) || defined(__orxIOS__)\r\n"
+                              "__asm__(\".const_data\\n.balign %u\\norxBundleBlob:\\n.incbin \\\"" orxBUNDLE_KZ_INCLUDE_FILENAME orxBUNDLE_KZ_BLOB_EXTENSION "\\\"\\n.text\\n\");\r\n"
+                              "#else // __orxMAC__ || __orxIOS__\r\n"
+                              "__asm__(\".pushsection .rodata\\n.balign %u\\norxBundleBlob:\\n.incbin \\\"" orxBUNDLE_KZ_INCLUDE_FILENAME orxBUNDLE_KZ_BLOB_EXTENSION "\\\"\\n.popsection\\n\");\r\n"
+                              "#endif // __orxMAC__ || __orxIOS__\r\n"
+                              "extern const orxU8 sau8BundleBlob[] __asm__(\"orxBundleBlob\");\r\n"
+                              "#else\r\n"
+                              "#error \"Binary bundle embedding requires #embed or .incbin support, please use [" orxBUNDLE_KZ_CONFIG_SECTION "] " orxBUNDLE_KZ_CONFIG_EMBED_MODE " = Hex instead.\"\r\n"
+                              "#endif\r\n\r\n",
+                              u32Alignment, u32Alignment, u32Alignment);
+          }
+
           // Outputs table header
           orxResource_Print(hOutput, "static const BundleData sastBundleDataList[] =\r\n{");
 
@@ -889,10 +2971,20 @@ static orxINLINE orxSTATUS orxBundle_Process()
             pstResourceRef = (orxBUNDLE_RESOURCE_REF *)orxBank_GetNext(pstResourceBank, pstResourceRef), u32ResourceIndex++)
           {
             // Outputs ref
-            orxResource_Print(hOutput, "\r\n  {0x%016llx /* %s */, (const orxU8 *)BundleData0x%x, %lld, %lld},", pstResourceRef->stNameID, orxString_GetFromID(pstResourceRef->stNameID), u32ResourceIndex, pstResourceRef->s64Size, pstResourceRef->s64FinalSize);
+            if(hBlob != orxHANDLE_UNDEFINED)
+            {
+              orxResource_Print(hOutput, "\r\n  {0x%016llx /* %s */, sau8BundleBlob + 0x%llx, %lld, %lld, 0x%x},", pstResourceRef->stNameID, orxString_GetFromID(pstResourceRef->stNameID), pstResourceRef->s64Offset, pstResourceRef->s64Size, pstResourceRef->s64FinalSize, pstResourceRef->u32Flags);
+            }
+            else
+            {
+              orxResource_Print(hOutput, "\r\n  {0x%016llx /* %s */, (const orxU8 *)BundleData0x%x, %lld, %lld, 0x%x},", pstResourceRef->stNameID, orxString_GetFromID(pstResourceRef->stNameID), pstResourceRef->u32DataIndex, pstResourceRef->s64Size, pstResourceRef->s64FinalSize, pstResourceRef->u32Flags);
+            }
 
             // Updates sizes
-            s64Size      += pstResourceRef->s64Size;
+            if(!orxFLAG_TEST(pstResourceRef->u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_DUPLICATE))
+            {
+              s64Size += pstResourceRef->s64Size;
+            }
             s64FinalSize += pstResourceRef->s64FinalSize;
           }
 
@@ -913,6 +3005,32 @@ static orxINLINE orxSTATUS orxBundle_Process()
               acPrintBuffer,
               orxBundle_GetHumanReadableSize(s64Size, 2),
               orx2F(100.0f) * orxS2F(s64Size) / orxS2F(s64FinalSize));
+
+        // For all dictionary groups
+        for(i = 0; i < u32DictionaryGroupCount; i++)
+        {
+          const BundleDictionaryGroup *pstGroup;
+
+          // Gets it
+          pstGroup = &astDictionaryGroupList[i];
+
+          // Used?
+          if(pstGroup->s64FinalSize > 0)
+          {
+            orxCHAR acPlainBuffer[32];
+
+            // Logs message
+            orxString_NPrint(acPrintBuffer, sizeof(acPrintBuffer), "%s", orxBundle_GetHumanReadableSize(pstGroup->s64FinalSize, 2));
+            orxString_NPrint(acPlainBuffer, sizeof(acPlainBuffer), "%s", orxBundle_GetHumanReadableSize(pstGroup->s64PlainSize, 2));
+            orxLOG(orxBUNDLE_KZ_LOG_TAG "Dictionary group " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET ", " orxANSI_KZ_COLOR_FG_GREEN "(%s) -> [%s]" orxANSI_KZ_COLOR_FG_CYAN " (%.2f%%)" orxANSI_KZ_COLOR_RESET " without, " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_FG_CYAN " (%.2f%%)" orxANSI_KZ_COLOR_RESET " with dictionary",
+                   pstGroup->zName,
+                   acPrintBuffer,
+                   acPlainBuffer,
+                   orx2F(100.0f) * orxS2F(pstGroup->s64PlainSize) / orxS2F(pstGroup->s64FinalSize),
+                   orxBundle_GetHumanReadableSize(pstGroup->s64Size, 2),
+                   orx2F(100.0f) * orxS2F(pstGroup->s64Size) / orxS2F(pstGroup->s64FinalSize));
+          }
+        }
       }
     }
 
@@ -926,12 +3044,26 @@ static orxINLINE orxSTATUS orxBundle_Process()
     // Deletes resource bank
     orxBank_Delete(pstResourceBank);
 
+    // Clears previous bundle
+    orxBundle_ClearPrevious();
+
+    // Closes blob resource
+    if(hBlob != orxHANDLE_UNDEFINED)
+    {
+      orxResource_Close(hBlob);
+    }
+
     // Closes output resource
-    orxResource_Close(hOutput);
     if(hOutput == sstBundle.hResource)
     {
+      // Moves it over the previous bundle
+      orxBundle_CloseOutput(hOutput, orxTRUE);
       sstBundle.hResource = orxHANDLE_UNDEFINED;
     }
+    else
+    {
+      orxResource_Close(hOutput);
+    }
   }
   else
   {
@@ -949,6 +3081,8 @@ static orxINLINE orxSTATUS orxBundle_Process()
   return eResult;
 }
 
+static void orxFASTCALL orxBundle_StartPrefetch();
+
 static orxSTATUS orxFASTCALL orxBundle_EventHandler(const orxEVENT *_pstEvent)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -975,6 +3109,11 @@ static orxSTATUS orxFASTCALL orxBundle_EventHandler(const orxEVENT *_pstEvent)
                                 "Creates a resource bundle.",
                                 "Creates a bundle of all resources that are either defined in config or loaded at init time.\n\t\t\tIf no output name is provided, code will be generated, ready to be used during the next compilation.",
                                 orxBundle_BundleParamHandler),
+        orxBUNDLE_DECLARE_PARAM("r",
+                                "record",
+                                "Records the access order of bundled resources.",
+                                "Records the order in which bundled resources get opened during this session and saves it to a manifest upon exit (default: " orxBUNDLE_KZ_DEFAULT_MANIFEST ").\n\t\t\tBundles created with this manifest as their Manifest property will follow that order and prefetch their first resources.",
+                                orxBundle_RecordParamHandler),
       };
 
       // For all params
@@ -988,6 +3127,27 @@ static orxSTATUS orxFASTCALL orxBundle_EventHandler(const orxEVENT *_pstEvent)
     }
     else
     {
+      // Pushes bundle section
+      orxConfig_PushSection(orxBUNDLE_KZ_CONFIG_SECTION);
+
+      // Has cache size?
+      if(orxConfig_HasValue(orxBUNDLE_KZ_CONFIG_CACHE_SIZE) != orxFALSE)
+      {
+        // Updates cache budget
+        sstBundle.s64CacheBudget = (orxS64)orxConfig_GetU64(orxBUNDLE_KZ_CONFIG_CACHE_SIZE);
+
+        // Evicts unused entries if needed
+        orxBundle_Lock();
+        orxBundle_TrimCache();
+        orxBundle_Unlock();
+      }
+
+      // Updates trace status
+      sstBundle.bTrace = orxConfig_GetBool(orxBUNDLE_KZ_CONFIG_TRACE);
+
+      // Pops config section
+      orxConfig_PopSection();
+
       // Should process?
       if(sstBundle.bProcess != orxFALSE)
       {
@@ -999,6 +3159,9 @@ static orxSTATUS orxFASTCALL orxBundle_EventHandler(const orxEVENT *_pstEvent)
       }
       else
       {
+        // Starts prefetching
+        orxBundle_StartPrefetch();
+
         // Updates result
         eResult = orxSTATUS_SUCCESS;
       }
@@ -1016,34 +3179,35 @@ static orxSTATUS orxFASTCALL orxBundle_EventHandler(const orxEVENT *_pstEvent)
 // Locate function, returns NULL if it can't handle the storage or if the resource can't be found in this storage
 const orxSTRING orxFASTCALL orxBundle_Locate(const orxSTRING _zGroup, const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
 {
-  static orxCHAR  sacBuffer[512];
-  static orxU32   su32StorageLength = 0;
-  orxSTRING       zResult = orxNULL;
-
-  if(su32StorageLength == 0)
-  {
-    su32StorageLength = orxString_GetLength(orxBUNDLE_KZ_RESOURCE_STORAGE);
-  }
+  orxSTRING zResult = orxNULL;
 
   // Bundle storage?
-  if(orxString_NCompare(_zStorage, orxBUNDLE_KZ_RESOURCE_STORAGE, su32StorageLength) == 0)
+  if(orxString_NCompare(_zStorage, orxBUNDLE_KZ_RESOURCE_STORAGE, sstBundle.u32StorageLength) == 0)
   {
     const orxSTRING zResource;
+    orxCHAR        *pcBuffer;
+    orxU32          u32ThreadID;
+
+    // Gets current thread ID
+    u32ThreadID = orxThread_GetCurrent();
+    orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+
+    // Gets this thread's location buffer
+    pcBuffer = sstBundle.aacLocationList[u32ThreadID];
 
     // Gets underlying resource
-    zResource = _zStorage + su32StorageLength;
+    zResource = _zStorage + sstBundle.u32StorageLength;
 
     // Not memory?
     if(*zResource != orxCHAR_NULL)
     {
-      static orxBOOL  sbLocating = orxFALSE;
       const orxSTRING zLocation;
 
-      // Not already locating?
-      if(sbLocating == orxFALSE)
+      // Not already locating on this thread?
+      if(sstBundle.abLocatingList[u32ThreadID] == orxFALSE)
       {
         // Updates status
-        sbLocating = orxTRUE;
+        sstBundle.abLocatingList[u32ThreadID] = orxTRUE;
 
         // Locates resource
         zLocation = orxResource_Locate(orxBUNDLE_KZ_RESOURCE_GROUP, zResource);
@@ -1051,114 +3215,49 @@ const orxSTRING orxFASTCALL orxBundle_Locate(const orxSTRING _zGroup, const orxS
         // Found?
         if(zLocation != orxNULL)
         {
-          orxHASHTABLE  **ppstToC;
-          orxSTRINGID     stLocationID;
-
-          // Gets its location ID
-          stLocationID = orxString_Hash(zLocation);
+          const BundleToC *pstToC;
 
           // Gets its ToC
-          ppstToC = (orxHASHTABLE **)orxHashTable_Retrieve(sstBundle.pstToCTable, stLocationID);
+          pstToC = orxBundle_GetToC(zLocation, orxString_Hash(zLocation));
 
-          // Not found?
-          if(*ppstToC == orxNULL)
+          // Valid?
+          if(pstToC != orxNULL)
           {
-            orxHANDLE hResource;
-            orxU32    u32ThreadID;
-
-            // Gets current thread ID
-            u32ThreadID = orxThread_GetCurrent();
-            orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+            BundleStats  *pstStats;
+            orxU32        u32ResourceIndex;
 
-            // Gets it from table
-            hResource = orxHashTable_Get(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)stLocationID);
+            // Updates stats
+            pstStats = orxBundle_GetStats();
+            pstStats->u32LocateCount++;
+            pstStats->u32LookupCount++;
 
-            // Found?
-            if(hResource != orxNULL)
-            {
-              orxS64 s64Offset;
-
-              // Resets it
-              s64Offset = orxResource_Seek(hResource, 0, orxSEEK_OFFSET_WHENCE_START);
-              orxASSERT(s64Offset == 0);
-            }
-            else
-            {
-              // Opens it
-              hResource = orxResource_Open(zLocation, orxFALSE);
-
-              // Success?
-              if(hResource != orxHANDLE_UNDEFINED)
-              {
-                orxSTATUS eResult;
+            // Finds resource
+            u32ResourceIndex = orxBundle_FindEntry(pstToC, orxString_Hash(_zName));
 
-                // Adds it to table
-                eResult = orxHashTable_Add(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)stLocationID, hResource);
-                orxASSERT(eResult != orxSTATUS_FAILURE);
-              }
-            }
-
-            // Success?
-            if(hResource != orxHANDLE_UNDEFINED)
+            // Valid?
+            if(u32ResourceIndex != orxU32_UNDEFINED)
             {
-              orxU8 acTag[4];
+              // Creates location string: location + name ID (stays valid when the bundle gets replaced)
+              orxString_NPrint(pcBuffer, orxBUNDLE_KU32_LOCATION_SIZE, "%s%c0x%016llx", zLocation, orxRESOURCE_KC_LOCATION_SEPARATOR, (orxU64)pstToC->astEntryList[u32ResourceIndex].stNameID);
 
-              // Is a valid bundle?
-              if((orxResource_Read(hResource, 4, &acTag, orxNULL, orxNULL) == 4)
-              && (orxMemory_Compare(orxBUNDLE_KZ_BINARY_TAG, acTag, 4) == 0))
+              // Recording?
+              if(sstBundle.pstRecordTable != orxNULL)
               {
-                orxU32 i, u32Count;
-
-                // Creates ToC
-                *ppstToC = orxHashTable_Create(orxBUNDLE_KU32_TOC_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-                orxASSERT(*ppstToC != orxNULL);
-
-                // For all stored resources
-                for(i = 0, u32Count = orxResource_ReadU32(hResource); i < u32Count; i++)
-                {
-                  orxSTRINGID stID;
-                  orxSTATUS   eResult;
-
-                  // Gets its ID
-                  stID = (orxSTRINGID)orxResource_ReadU64(hResource);
-
-                  // Adds it
-                  eResult = orxHashTable_Add(*ppstToC, stID, (void *)(orxUPTR)(i + 1));
-                  orxASSERT(eResult != orxSTATUS_FAILURE);
-
-                  // Skips entry
-                  orxResource_Seek(hResource, orxBUNDLE_KU32_HEADER_ENTRY_SIZE - 8, orxSEEK_OFFSET_WHENCE_CURRENT);
-                }
+                // Records its name
+                orxBundle_RecordLocate(pstToC->astEntryList[u32ResourceIndex].stNameID, _zName);
               }
-            }
-          }
-
-          // Valid?
-          if(*ppstToC != orxNULL)
-          {
-            orxSTRINGID stResourceID;
-            orxU32      u32ResourceIndex;
-
-            // Gets resource ID
-            stResourceID = orxString_Hash(_zName);
-
-            // Retrieves its index
-            u32ResourceIndex = (orxU32)(orxUPTR)orxHashTable_Get(*ppstToC, stResourceID);
-
-            // Valid?
-            if(u32ResourceIndex != 0)
-            {
-              // Creates location string: location + index
-              orxString_NPrint(sacBuffer, sizeof(sacBuffer), "%s%c0x%x", zLocation, orxRESOURCE_KC_LOCATION_SEPARATOR, u32ResourceIndex - 1);
 
               // Updates result
-              zResult = sacBuffer;
+              zResult = pcBuffer;
             }
+
+            // Releases ToC
+            orxBundle_ReleaseToC(pstToC);
           }
         }
 
         // Updates status
-        sbLocating = orxFALSE;
+        sstBundle.abLocatingList[u32ThreadID] = orxFALSE;
       }
     }
     else
@@ -1179,10 +3278,10 @@ const orxSTRING orxFASTCALL orxBundle_Locate(const orxSTRING _zGroup, const orxS
         if(pstData != orxNULL)
         {
           // Creates location string: index of file
-          orxString_NPrint(sacBuffer, sizeof(sacBuffer), "0x%x", (orxU32)(pstData - sastBundleDataList));
+          orxString_NPrint(pcBuffer, orxBUNDLE_KU32_LOCATION_SIZE, "0x%x", (orxU32)(pstData - sastBundleDataList));
 
           // Updates result
-          zResult = sacBuffer;
+          zResult = pcBuffer;
         }
       }
     }
@@ -1192,6 +3291,118 @@ const orxSTRING orxFASTCALL orxBundle_Locate(const orxSTRING _zGroup, const orxS
   return zResult;
 }
 
+// GetTime function: returns the time of the underlying bundle and retires its ToC when it got replaced
+orxS64 orxFASTCALL orxBundle_GetTime(const orxSTRING _zLocation)
+{
+  const orxSTRING zLastSeparator;
+  orxS64          s64Result = 0;
+
+  // Finds last separator
+  zLastSeparator = orxBundle_GetLastSeparator(_zLocation);
+
+  // Found?
+  if(zLastSeparator != orxNULL)
+  {
+    orxCHAR           acBuffer[orxBUNDLE_KU32_LOCATION_SIZE];
+    BundleToC        *pstToC;
+    const BundleToC  *pstCurrentToC;
+    orxSTRINGID       stLocationID;
+    orxU64            u64NameID;
+    orxU32            i, u32Index;
+
+    // Copies its name
+    orxString_NPrint(acBuffer, sizeof(acBuffer), "%.*s", (orxU32)(zLastSeparator - _zLocation), _zLocation);
+
+    // Gets its location ID
+    stLocationID = orxString_Hash(acBuffer);
+
+    // Gets underlying time
+    s64Result = orxResource_GetTime(acBuffer);
+
+    // Locks bundle
+    orxBundle_Lock();
+
+    // Has a ToC loaded before the last modification?
+    if(((pstToC = (BundleToC *)orxHashTable_Get(sstBundle.pstToCTable, stLocationID)) != orxNULL)
+    && (pstToC->s64Time != s64Result))
+    {
+      // Retires it, as other threads might still be using it, and keeps it alive until its entries' times have been carried over
+      orxHashTable_Remove(sstBundle.pstToCTable, stLocationID);
+      pstToC->u32RefCount++;
+      pstToC->bRetired            = orxTRUE;
+      pstToC->pstNext             = sstBundle.pstRetiredToCList;
+      sstBundle.pstRetiredToCList = pstToC;
+
+      // Flushes its cached content
+      orxBundle_FlushCache(stLocationID);
+
+      // Invalidates all threads' handles
+      sstBundle.u32Generation++;
+
+      // Logs message
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, orxANSI_KZ_COLOR_FG_YELLOW "[Bundle]" orxANSI_KZ_COLOR_RESET " Bundle " orxANSI_KZ_COLOR_FG_GREEN "[%s]" orxANSI_KZ_COLOR_RESET " has been modified, reloading its table of content.", acBuffer);
+    }
+    else
+    {
+      // Nothing to retire
+      pstToC = orxNULL;
+    }
+
+    // Unlocks bundle
+    orxBundle_Unlock();
+
+    // Gets current ToC
+    pstCurrentToC = orxBundle_GetToC(acBuffer, stLocationID);
+
+    // Valid?
+    if(pstCurrentToC != orxNULL)
+    {
+      // Just replaced?
+      if(pstToC != orxNULL)
+      {
+        // For all entries
+        for(i = 0; i < pstCurrentToC->u32Count; i++)
+        {
+          BundleEntry *pstEntry;
+
+          // Gets it
+          pstEntry = (BundleEntry *)&(pstCurrentToC->astEntryList[i]);
+
+          // Unchanged content? (no hash means unknown content)
+          if((pstEntry->u64Hash != 0)
+          && ((u32Index = orxBundle_FindEntry(pstToC, pstEntry->stNameID)) != orxU32_UNDEFINED)
+          && (pstToC->astEntryList[u32Index].u64Hash == pstEntry->u64Hash)
+          && (pstToC->astEntryList[u32Index].s64FinalSize == pstEntry->s64FinalSize))
+          {
+            // Keeps its previous time, so that it doesn't get reloaded
+            pstEntry->s64Time = pstToC->astEntryList[u32Index].s64Time;
+          }
+        }
+      }
+
+      // Gets entry's time
+      if((orxString_ToU64(zLastSeparator + 1, &u64NameID, orxNULL) != orxSTATUS_FAILURE)
+      && ((u32Index = orxBundle_FindEntry(pstCurrentToC, (orxSTRINGID)u64NameID)) != orxU32_UNDEFINED))
+      {
+        s64Result = pstCurrentToC->astEntryList[u32Index].s64Time;
+      }
+
+      // Releases it
+      orxBundle_ReleaseToC(pstCurrentToC);
+    }
+
+    // Has retired ToC?
+    if(pstToC != orxNULL)
+    {
+      // Releases it
+      orxBundle_ReleaseToC(pstToC);
+    }
+  }
+
+  // Done!
+  return s64Result;
+}
+
 // Open function: returns an opaque handle for subsequent function calls (GetSize, Seek, Tell, Read and Close) upon success, orxHANDLE_UNDEFINED otherwise
 orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bEraseMode)
 {
@@ -1200,107 +3411,83 @@ orxHANDLE orxFASTCALL orxBundle_Open(const orxSTRING _zLocation, orxBOOL _bErase
   // Not in erase mode?
   if(_bEraseMode == orxFALSE)
   {
-    const orxSTRING zSeparator;
-    const orxSTRING zLastSeparator = orxNULL;
+    const orxSTRING zLastSeparator;
     orxU32          u32Index;
 
     // Finds last separator
-    for(zSeparator = orxString_SearchChar(_zLocation, orxRESOURCE_KC_LOCATION_SEPARATOR);
-        zSeparator != orxNULL;
-        zLastSeparator = zSeparator, zSeparator = orxString_SearchChar(zSeparator + 1, orxRESOURCE_KC_LOCATION_SEPARATOR))
-      ;
+    zLastSeparator = orxBundle_GetLastSeparator(_zLocation);
 
     // Found?
     if(zLastSeparator != orxNULL)
     {
-      static orxCHAR  sacBuffer[512];
-      orxHANDLE       hResource;
-      orxSTRINGID     stLocationID;
-      orxU32          u32ThreadID;
-
-      // Gets current thread ID
-      u32ThreadID = orxThread_GetCurrent();
-      orxASSERT(u32ThreadID != orxU32_UNDEFINED);
+      orxCHAR           acBuffer[orxBUNDLE_KU32_LOCATION_SIZE];
+      const BundleToC  *pstToC;
+      orxSTRINGID       stLocationID;
+      orxU64            u64NameID;
 
       // Copies its name
-      orxString_NPrint(sacBuffer, sizeof(sacBuffer), "%.*s", (orxU32)(zLastSeparator - _zLocation), _zLocation);
+      orxString_NPrint(acBuffer, sizeof(acBuffer), "%.*s", (orxU32)(zLastSeparator - _zLocation), _zLocation);
 
       // Gets its location ID
-      stLocationID = orxString_Hash(sacBuffer);
+      stLocationID = orxString_Hash(acBuffer);
 
-      // Gets it from table
-      hResource = orxHashTable_Get(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)stLocationID);
+      // Gets its ToC
+      pstToC = orxBundle_GetToC(acBuffer, stLocationID);
 
-      // Found?
-      if(hResource != orxNULL)
-      {
-        orxS64 s64Offset;
+      // Updates stats
+      orxBundle_GetStats()->u32LookupCount++;
 
-        // Resets it
-        s64Offset = orxResource_Seek(hResource, 0, orxSEEK_OFFSET_WHENCE_START);
-        orxASSERT(s64Offset == 0);
-      }
-      else
+      // Retrieves resource index
+      if((pstToC != orxNULL)
+      && (orxString_ToU64(zLastSeparator + 1, &u64NameID, orxNULL) != orxSTATUS_FAILURE)
+      && ((u32Index = orxBundle_FindEntry(pstToC, (orxSTRINGID)u64NameID)) != orxU32_UNDEFINED))
       {
-        // Opens it
-        hResource = orxResource_Open(sacBuffer, orxFALSE);
-
-        // Success?
-        if(hResource != orxHANDLE_UNDEFINED)
-        {
-          orxSTATUS eResult;
-
-          // Adds it to table
-          eResult = orxHashTable_Add(sstBundle.apstResourceTableList[u32ThreadID], (orxU64)stLocationID, hResource);
-          orxASSERT(eResult != orxSTATUS_FAILURE);
-        }
-      }
+        BundleResource *pstResource;
 
-      // Success?
-      if(hResource != orxHANDLE_UNDEFINED)
-      {
-        orxU8 acTag[4];
+        // Allocates memory for our bundle resource
+        pstResource = (BundleResource *)orxMemory_Allocate(sizeof(BundleResource), orxMEMORY_TYPE_MAIN);
 
-        // Is a valid bundle?
-        if((orxResource_Read(hResource, 4, &acTag, orxNULL, orxNULL) == 4)
-        && (orxMemory_Compare(orxBUNDLE_KZ_BINARY_TAG, acTag, 4) == 0))
+        // Success?
+        if(pstResource != orxNULL)
         {
-          orxU32 u32Index;
-
-          // Retrieves resource index
-          if((orxString_ToU32(zLastSeparator + 1, &u32Index, orxNULL) != orxSTATUS_FAILURE)
-          && (u32Index < orxResource_ReadU32(hResource)))
-          {
-            BundleResource *pstResource;
+          const BundleEntry *pstEntry;
 
-            // Allocates memory for our bundle resource
-            pstResource = (BundleResource *)orxMemory_Allocate(sizeof(BundleResource), orxMEMORY_TYPE_MAIN);
+          // Updates stats
+          orxBundle_GetStats()->u32OpenCount++;
 
-            // Success?
-            if(pstResource != orxNULL)
-            {
-              // Clears memory
-              orxMemory_Zero(pstResource, sizeof(BundleResource));
-
-              // Stores its internal resource
-              pstResource->stData.hResource = hResource;
-
-              // Skips to its info
-              orxResource_Seek(hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE + u32Index * orxBUNDLE_KU32_HEADER_ENTRY_SIZE + 8 + 4, orxSEEK_OFFSET_WHENCE_START);
+          // Clears memory
+          orxMemory_Zero(pstResource, sizeof(BundleResource));
 
-              // Stores it
-              pstResource->stData.s64Size       = (orxS64)orxResource_ReadU32(hResource);
-              pstResource->stData.s64FinalSize  = (orxS64)orxResource_ReadU32(hResource);
+          // Gets its entry
+          pstEntry = &(pstToC->astEntryList[u32Index]);
 
-              // Skips to its entry
-              orxResource_Seek(hResource, orxBUNDLE_KU32_HEADER_INTRO_SIZE + u32Index * orxBUNDLE_KU32_HEADER_ENTRY_SIZE, orxSEEK_OFFSET_WHENCE_START);
+          // Stores its info
+          pstResource->pstToC               = pstToC;
+          pstResource->stBundleID           = stLocationID;
+          pstResource->s64Offset            = pstEntry->s64Offset;
+          pstResource->stData.stNameID      = pstEntry->stNameID;
+          pstResource->stData.s64Size       = pstEntry->s64Size;
+          pstResource->stData.s64FinalSize  = pstEntry->s64FinalSize;
+          pstResource->stData.u32Flags      = pstEntry->u32Flags;
 
-              // Updates result
-              hResult = (orxHANDLE)pstResource;
-            }
+          // Recording?
+          if(sstBundle.pstRecordTable != orxNULL)
+          {
+            // Records its access
+            orxBundle_RecordOpen(pstEntry->stNameID);
           }
+
+          // Updates result
+          hResult = (orxHANDLE)pstResource;
         }
       }
+
+      // ToC not referenced by a new handle?
+      if((pstToC != orxNULL) && (hResult == orxHANDLE_UNDEFINED))
+      {
+        // Releases it
+        orxBundle_ReleaseToC(pstToC);
+      }
     }
     else
     {
@@ -1341,13 +3528,26 @@ void orxFASTCALL orxBundle_Close(orxHANDLE _hResource)
   // Gets resource
   pstResource = (BundleResource *)_hResource;
 
+  // Has cached content?
+  if(pstResource->pstCacheEntry != orxNULL)
+  {
+    // Releases it
+    orxBundle_ReleaseCacheEntry(pstResource->pstCacheEntry);
+  }
   // Has final buffer?
-  if(pstResource->pu8FinalBuffer != orxNULL)
+  else if(pstResource->pu8FinalBuffer != orxNULL)
   {
     // Frees it
     orxMemory_Free(pstResource->pu8FinalBuffer);
   }
 
+  // Has ToC?
+  if(pstResource->pstToC != orxNULL)
+  {
+    // Releases it
+    orxBundle_ReleaseToC(pstResource->pstToC);
+  }
+
   // Frees it
   orxMemory_Free(pstResource);
 
@@ -1452,65 +3652,131 @@ orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_
   // No final buffer?
   if(pstResource->pu8FinalBuffer == orxNULL)
   {
+    // Retains cached content
+    pstResource->pstCacheEntry = orxBundle_RetainCacheEntry(pstResource->stData.stNameID, pstResource->stBundleID);
+
+    // Found?
+    if(pstResource->pstCacheEntry != orxNULL)
+    {
+      // Uses it
+      pstResource->pu8FinalBuffer = pstResource->pstCacheEntry->pu8Buffer;
+    }
+  }
+
+  // No final buffer?
+  if(pstResource->pu8FinalBuffer == orxNULL)
+  {
+    BundleStats    *pstStats;
     orxS64          s64Size;
+    orxDOUBLE       dTime, dReadTime, dDecryptTime, dDecompressTime;
     const orxSTRING zKey;
     orxU8          *pu8Buffer;
+    orxBOOL         bStored;
+
+    // Gets this thread's stats
+    pstStats = orxBundle_GetStats();
 
-    // Allocates intermediate buffer
-    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64Size, orxMEMORY_TYPE_TEMP);
+    // Is payload stored as-is?
+    bStored = orxFLAG_TEST(pstResource->stData.u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_STORED) ? orxTRUE : orxFALSE;
+
+    // Allocates intermediate buffer (final one if payload isn't compressed)
+    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64Size, (bStored != orxFALSE) ? orxMEMORY_TYPE_MAIN : orxMEMORY_TYPE_TEMP);
     orxASSERT(pu8Buffer);
 
     // Gets encryption key
     zKey = orxConfig_GetEncryptionKey();
 
+    // Gets start time
+    dTime = orxSystem_GetSystemTime();
+
     // Has external resource?
     if(pstResource->stData.pu8Buffer == orxNULL)
     {
-      const orxU8  *pu8Key;
-      orxU8        *pu8Data;
-      orxHANDLE     hResource;
+      orxHANDLE hResource;
 
-      // Gets it
-      hResource = pstResource->stData.hResource;
-
-      // Store its ID
-      pstResource->stData.stNameID = orxResource_ReadU64(hResource);
-
-      // Skips to content
-      orxResource_Seek(hResource, (orxS64)orxResource_ReadU32(hResource), orxSEEK_OFFSET_WHENCE_START);
+      // Gets this thread's underlying resource
+      hResource = orxBundle_GetResource(orxNULL, pstResource->stBundleID);
 
       // Reads its content
-      s64Size = orxResource_Read(hResource, pstResource->stData.s64Size, pu8Buffer, orxNULL, orxNULL);
-      orxASSERT(s64Size == pstResource->stData.s64Size);
-
-      // Decrypts data
-      for(pu8Key = (const orxU8 *)zKey, pu8Data = pu8Buffer;
-          pu8Data < pu8Buffer + pstResource->stData.s64Size;
-          pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Data++)
+      if((hResource != orxHANDLE_UNDEFINED)
+      && (orxResource_Seek(hResource, pstResource->s64Offset, orxSEEK_OFFSET_WHENCE_START) == pstResource->s64Offset))
+      {
+        s64Size = orxResource_Read(hResource, pstResource->stData.s64Size, pu8Buffer, orxNULL, orxNULL);
+      }
+      else
       {
-        *pu8Data ^= *pu8Key;
+        s64Size = 0;
       }
+      orxASSERT(s64Size == pstResource->stData.s64Size);
+    }
+    else
+    {
+      // Copies its content
+      orxMemory_Copy(pu8Buffer, pstResource->stData.pu8Buffer, (orxU32)pstResource->stData.s64Size);
+    }
+
+    // Updates read time
+    dReadTime = orxSystem_GetSystemTime();
+    dDecryptTime = dReadTime;
+    dReadTime -= dTime;
+    dTime = dDecryptTime;
+
+    // Decrypts data
+    orxBundle_Crypt(pu8Buffer, pstResource->stData.s64Size, zKey);
+
+    // Updates decrypt time
+    dDecompressTime = orxSystem_GetSystemTime();
+    dDecryptTime = dDecompressTime - dTime;
+    dTime = dDecompressTime;
+
+    // Stored?
+    if(bStored != orxFALSE)
+    {
+      // Uses it as final buffer
+      pstResource->pu8FinalBuffer = pu8Buffer;
+      s64Size                     = pstResource->stData.s64Size;
+      pu8Buffer                   = orxNULL;
     }
     else
     {
-      const orxU8  *pu8Key, *pu8Src;
-      orxU8        *pu8Dst;
+      // Allocates final buffer
+      pstResource->pu8FinalBuffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64FinalSize, orxMEMORY_TYPE_MAIN);
+      orxASSERT(pstResource->pu8FinalBuffer != orxNULL);
 
-      // Decrypts data
-      for(pu8Key = (const orxU8 *)zKey, pu8Src = pstResource->stData.pu8Buffer, pu8Dst = pu8Buffer;
-          pu8Src < pstResource->stData.pu8Buffer + pstResource->stData.s64Size;
-          pu8Key = (*pu8Key == orxCHAR_NULL) ? (const orxU8 *)zKey : pu8Key + 1, pu8Src++, pu8Dst++)
+      // Compressed with dictionary?
+      if(orxFLAG_TEST(pstResource->stData.u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_USE_DICTIONARY))
+      {
+        // Decompresses data
+        s64Size = ((pstResource->pstToC != orxNULL) && (pstResource->pstToC->pu8Dictionary != orxNULL))
+                ? (orxS64)LZ4_decompress_safe_usingDict((const char *)pu8Buffer, (char *)pstResource->pu8FinalBuffer, (int)pstResource->stData.s64Size, (int)pstResource->stData.s64FinalSize, (const char *)pstResource->pstToC->pu8Dictionary, (int)pstResource->pstToC->s64DictionarySize)
+                : -1;
+      }
+      else
       {
-        *pu8Dst = *pu8Src ^ *pu8Key;
+        // Decompresses data
+        s64Size = (orxS64)LZ4_decompress_safe((const char *)pu8Buffer, (char *)pstResource->pu8FinalBuffer, (int)pstResource->stData.s64Size, (int)pstResource->stData.s64FinalSize);
       }
+
+      // Updates decompression stats
+      pstStats->u32DecompressCount++;
+      pstStats->u64DecompressedSize += (orxU64)pstResource->stData.s64FinalSize;
     }
 
-    // Allocates final buffer
-    pstResource->pu8FinalBuffer = (orxU8 *)orxMemory_Allocate((orxU32)pstResource->stData.s64FinalSize, orxMEMORY_TYPE_MAIN);
-    orxASSERT(pstResource->pu8FinalBuffer != orxNULL);
+    // Updates decompress time
+    dDecompressTime = orxSystem_GetSystemTime() - dTime;
 
-    // Decompresses data
-    s64Size = (orxS64)LZ4_decompress_safe((const char *)pu8Buffer, (char *)pstResource->pu8FinalBuffer, (int)pstResource->stData.s64Size, (int)pstResource->stData.s64FinalSize);
+    // Updates stats
+    pstStats->u64ReadSize     += (orxU64)pstResource->stData.s64Size;
+    pstStats->dReadTime       += dReadTime;
+    pstStats->dDecryptTime    += dDecryptTime;
+    pstStats->dDecompressTime += dDecompressTime;
+
+    // Tracing?
+    if(sstBundle.bTrace != orxFALSE)
+    {
+      // Logs message
+      orxLOG(orxBUNDLE_KZ_LOG_TAG "Read " orxANSI_KZ_COLOR_FG_MAGENTA "%s" orxANSI_KZ_COLOR_RESET " (" orxANSI_KZ_COLOR_FG_CYAN "%lld" orxANSI_KZ_COLOR_RESET " -> " orxANSI_KZ_COLOR_FG_CYAN "%lld" orxANSI_KZ_COLOR_RESET " bytes) | Read: %.3fms, Decrypt: %.3fms, Decompress: %.3fms", orxString_GetFromID(pstResource->stData.stNameID), pstResource->stData.s64Size, pstResource->stData.s64FinalSize, dReadTime * 1000.0, dDecryptTime * 1000.0, dDecompressTime * 1000.0);
+    }
 
     // Failure?
     if(s64Size != pstResource->stData.s64FinalSize)
@@ -1521,9 +3787,17 @@ orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_
       // Updates its final size
       pstResource->stData.s64FinalSize = 0;
     }
+    else
+    {
+      // Adds it to the cache
+      pstResource->pstCacheEntry = orxBundle_AddCacheEntry(pstResource->stData.stNameID, pstResource->stBundleID, pstResource->pu8FinalBuffer, pstResource->stData.s64FinalSize);
+    }
 
     // Deletes intermediate buffer
-    orxMemory_Free(pu8Buffer);
+    if(pu8Buffer != orxNULL)
+    {
+      orxMemory_Free(pu8Buffer);
+    }
   }
 
   // Gets actual copy size to prevent any out-of-bound access
@@ -1543,6 +3817,130 @@ orxS64 orxFASTCALL orxBundle_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_
   return s64CopySize;
 }
 
+// Prefetch task: warms up the decompressed cache with a bundle's prefetch entries
+static orxSTATUS orxFASTCALL orxBundle_Prefetch(void *_pContext)
+{
+  const BundleToC  *pstToC;
+  orxSTRING         zLocation;
+
+  // Gets location
+  zLocation = (orxSTRING)_pContext;
+
+  // Gets its ToC
+  pstToC = orxBundle_GetToC(zLocation, orxString_Hash(zLocation));
+
+  // Valid?
+  if(pstToC != orxNULL)
+  {
+    orxS64 s64Size = 0;
+    orxU32 i;
+
+    // For all entries
+    for(i = 0; (i < pstToC->u32Count) && (sstBundle.bStopPrefetch == orxFALSE); i++)
+    {
+      const BundleEntry *pstEntry;
+
+      // Gets it
+      pstEntry = &(pstToC->astEntryList[i]);
+
+      // Should prefetch and still fits in cache?
+      if((orxFLAG_TEST(pstEntry->u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_PREFETCH))
+      && (s64Size + pstEntry->s64FinalSize <= sstBundle.s64CacheBudget))
+      {
+        orxCHAR   acBuffer[orxBUNDLE_KU32_LOCATION_SIZE];
+        orxHANDLE hResource;
+
+        // Opens it
+        orxString_NPrint(acBuffer, sizeof(acBuffer), "%s%c0x%016llx", zLocation, orxRESOURCE_KC_LOCATION_SEPARATOR, (orxU64)pstEntry->stNameID);
+        hResource = orxBundle_Open(acBuffer, orxFALSE);
+
+        // Success?
+        if(hResource != orxHANDLE_UNDEFINED)
+        {
+          // Decompresses it into the cache
+          orxBundle_Read(hResource, 0, orxNULL);
+          orxBundle_Close(hResource);
+
+          // Updates size
+          s64Size += pstEntry->s64FinalSize;
+        }
+      }
+    }
+
+    // Releases ToC
+    orxBundle_ReleaseToC(pstToC);
+  }
+
+  // Deletes location
+  orxString_Delete(zLocation);
+
+  // Updates pending count
+  orxBundle_Lock();
+  sstBundle.u32PrefetchCount--;
+  orxBundle_Unlock();
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxBundle_StartPrefetch()
+{
+  orxHANDLE   hIterator;
+  BundleToC  *pstToC;
+  orxSTRING  *azLocationList;
+  orxU32      i, u32Count = 0;
+
+  // Locks bundle
+  orxBundle_Lock();
+
+  // Allocates location list
+  azLocationList = (orxSTRING *)orxMemory_Allocate((orxHashTable_GetCount(sstBundle.pstToCTable) + 1) * sizeof(orxSTRING), orxMEMORY_TYPE_TEMP);
+  orxASSERT(azLocationList != orxNULL);
+
+  // For all ToCs
+  for(hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstToC);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(sstBundle.pstToCTable, hIterator, orxNULL, (void **)&pstToC))
+  {
+    // Has prefetch entries?
+    for(i = 0; (i < pstToC->u32Count) && !orxFLAG_TEST(pstToC->astEntryList[i].u32Flags, orxBUNDLE_KU32_ENTRY_FLAG_PREFETCH); i++)
+      ;
+    if(i < pstToC->u32Count)
+    {
+      // Stores its location
+      azLocationList[u32Count++] = orxString_Duplicate(pstToC->zLocation);
+    }
+  }
+
+  // Updates pending count
+  sstBundle.u32PrefetchCount += u32Count;
+
+  // Unlocks bundle
+  orxBundle_Unlock();
+
+  // For all locations
+  for(i = 0; i < u32Count; i++)
+  {
+    // Runs prefetch task
+    if(orxThread_RunTask(&orxBundle_Prefetch, orxNULL, orxNULL, azLocationList[i]) == orxSTATUS_FAILURE)
+    {
+      // Updates pending count
+      orxBundle_Lock();
+      sstBundle.u32PrefetchCount--;
+      orxBundle_Unlock();
+
+      // Deletes location
+      orxString_Delete(azLocationList[i]);
+    }
+  }
+
+  // Frees location list
+  orxMemory_Free(azLocationList);
+
+  // Done!
+  return;
+}
+
 orxSTATUS orxFASTCALL orxBundle_Init()
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -1554,18 +3952,49 @@ orxSTATUS orxFASTCALL orxBundle_Init()
 
     // Inits variables
     orxMemory_Zero(sstBundle.acPrintBuffer, sizeof(sstBundle.acPrintBuffer));
+    orxMemory_Zero(sstBundle.acStatsBuffer, sizeof(sstBundle.acStatsBuffer));
+    orxMemory_Zero(sstBundle.aacLocationList, sizeof(sstBundle.aacLocationList));
+    orxMemory_Zero(sstBundle.abLocatingList, sizeof(sstBundle.abLocatingList));
     orxMemory_Zero(sstBundle.apstResourceTableList, sizeof(sstBundle.apstResourceTableList));
-    sstBundle.pstToCTable     = orxNULL;
-    sstBundle.pstDataTable    = orxNULL;
-    sstBundle.hResource       = orxHANDLE_UNDEFINED;
-    sstBundle.u32DataCount    = (sastBundleDataList != orxNULL) ? orxARRAY_GET_ITEM_COUNT(sastBundleDataList) : 0;
-    sstBundle.bProcess        = orxFALSE;
+    orxMemory_Zero(sstBundle.au32GenerationList, sizeof(sstBundle.au32GenerationList));
+    orxMemory_Zero(&(sstBundle.stCacheList), sizeof(orxLINKLIST));
+    sstBundle.pstToCTable           = orxNULL;
+    sstBundle.pstDataTable          = orxNULL;
+    sstBundle.pstCacheTable         = orxNULL;
+    sstBundle.pstCacheBank          = orxNULL;
+    sstBundle.s64CacheSize          = 0;
+    sstBundle.s64CacheBudget        = orxBUNDLE_KU64_CACHE_SIZE;
+    sstBundle.u32CacheHitCount      = 0;
+    sstBundle.u32CacheMissCount     = 0;
+    sstBundle.u32CacheEvictionCount = 0;
+    sstBundle.u32Generation         = 0;
+    sstBundle.bTrace                = orxFALSE;
+    orxMemory_Zero(sstBundle.astStatsList, sizeof(sstBundle.astStatsList));
+    sstBundle.pstRetiredToCList     = orxNULL;
+    sstBundle.pstRecordTable        = orxNULL;
+    sstBundle.pstRecordBank         = orxNULL;
+    sstBundle.zManifest             = orxNULL;
+    sstBundle.u32RecordCount        = 0;
+    sstBundle.u32PrefetchCount      = 0;
+    sstBundle.bStopPrefetch         = orxFALSE;
+    sstBundle.hResource             = orxHANDLE_UNDEFINED;
+    sstBundle.pstPreviousToC        = orxNULL;
+    sstBundle.hPreviousResource     = orxHANDLE_UNDEFINED;
+    sstBundle.acOutputLocation[0]   = orxCHAR_NULL;
+    sstBundle.acTempLocation[0]     = orxCHAR_NULL;
+    sstBundle.u32DataCount          = (sastBundleDataList != orxNULL) ? orxARRAY_GET_ITEM_COUNT(sastBundleDataList) : 0;
+    sstBundle.u32StorageLength      = orxString_GetLength(orxBUNDLE_KZ_RESOURCE_STORAGE);
+    sstBundle.bProcess              = orxFALSE;
+
+    // Creates semaphore
+    sstBundle.pstSemaphore = orxThread_CreateSemaphore(1);
+    orxASSERT(sstBundle.pstSemaphore != orxNULL);
 
     // Inits our bundle resource type
     orxMemory_Zero(&stInfo, sizeof(orxRESOURCE_TYPE_INFO));
     stInfo.zTag       = orxBUNDLE_KZ_RESOURCE_TAG;
     stInfo.pfnLocate  = &orxBundle_Locate;
-    stInfo.pfnGetTime = orxNULL;                // No hotload support
+    stInfo.pfnGetTime = &orxBundle_GetTime;
     stInfo.pfnOpen    = &orxBundle_Open;
     stInfo.pfnClose   = &orxBundle_Close;
     stInfo.pfnGetSize = &orxBundle_GetSize;
@@ -1607,6 +4036,12 @@ orxSTATUS orxFASTCALL orxBundle_Init()
       sstBundle.pstToCTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       orxASSERT(sstBundle.pstToCTable != orxNULL);
 
+      // Creates cache table & bank
+      sstBundle.pstCacheTable = orxHashTable_Create(orxBUNDLE_KU32_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      orxASSERT(sstBundle.pstCacheTable != orxNULL);
+      sstBundle.pstCacheBank = orxBank_Create(orxBUNDLE_KU32_TABLE_SIZE, sizeof(BundleCacheEntry), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+      orxASSERT(sstBundle.pstCacheBank != orxNULL);
+
       // Creates resource tables
       for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.apstResourceTableList); i++)
       {
@@ -1617,6 +4052,9 @@ orxSTATUS orxFASTCALL orxBundle_Init()
       // Registers commands
       orxCOMMAND_REGISTER_CORE_COMMAND(Bundle, IsProcessing, "Processing?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
       orxCOMMAND_REGISTER_CORE_COMMAND(Bundle, GetOutputName, "Name", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+      orxCOMMAND_REGISTER_CORE_COMMAND(Bundle, Stats, "Stats", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+      orxCOMMAND_REGISTER_CORE_COMMAND(Bundle, ResetStats, "Stats", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+      orxCOMMAND_REGISTER_CORE_COMMAND(Bundle, Upgrade, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 2, 0, {"Input", orxCOMMAND_VAR_TYPE_STRING}, {"Output", orxCOMMAND_VAR_TYPE_STRING});
 
       // Registers event handler
       orxEvent_AddHandler(orxEVENT_TYPE_SYSTEM, orxBundle_EventHandler);
@@ -1627,6 +4065,12 @@ orxSTATUS orxFASTCALL orxBundle_Init()
       // Updates status
       sstBundle.bInit = orxTRUE;
     }
+    else
+    {
+      // Deletes semaphore
+      orxThread_DeleteSemaphore(sstBundle.pstSemaphore);
+      sstBundle.pstSemaphore = orxNULL;
+    }
   }
 
   // Done!
@@ -1647,15 +4091,36 @@ void orxFASTCALL orxBundle_Exit()
     // Unregisters commands
     orxCOMMAND_UNREGISTER_CORE_COMMAND(Bundle, IsProcessing);
     orxCOMMAND_UNREGISTER_CORE_COMMAND(Bundle, GetOutputName);
+    orxCOMMAND_UNREGISTER_CORE_COMMAND(Bundle, Stats);
+    orxCOMMAND_UNREGISTER_CORE_COMMAND(Bundle, ResetStats);
+    orxCOMMAND_UNREGISTER_CORE_COMMAND(Bundle, Upgrade);
+
+    // Stops prefetching
+    sstBundle.bStopPrefetch = orxTRUE;
+    while(sstBundle.u32PrefetchCount != 0)
+    {
+      orxThread_Yield();
+    }
+
+    // Recording?
+    if(sstBundle.pstRecordTable != orxNULL)
+    {
+      // Saves & clears records
+      orxBundle_SaveRecords();
+      orxBundle_ClearRecords();
+    }
 
     // Has pending resource?
     if(sstBundle.hResource != orxHANDLE_UNDEFINED)
     {
-      // Closes it
-      orxResource_Close(sstBundle.hResource);
+      // Discards it
+      orxBundle_CloseOutput(sstBundle.hResource, orxFALSE);
       sstBundle.hResource = orxHANDLE_UNDEFINED;
     }
 
+    // Clears previous bundle
+    orxBundle_ClearPrevious();
+
     // Has data table?
     if(sstBundle.pstDataTable != orxNULL)
     {
@@ -1674,6 +4139,15 @@ void orxFASTCALL orxBundle_Exit()
     // Clears resource tables
     orxBundle_ClearResourceTables();
 
+    // Clears cache
+    orxBundle_ClearCache();
+
+    // Deletes cache table & bank
+    orxHashTable_Delete(sstBundle.pstCacheTable);
+    sstBundle.pstCacheTable = orxNULL;
+    orxBank_Delete(sstBundle.pstCacheBank);
+    sstBundle.pstCacheBank = orxNULL;
+
     // For all resource tables
     for(i = 0; i < orxARRAY_GET_ITEM_COUNT(sstBundle.apstResourceTableList); i++)
     {
@@ -1682,6 +4156,10 @@ void orxFASTCALL orxBundle_Exit()
       sstBundle.apstResourceTableList[i] = orxNULL;
     }
 
+    // Deletes semaphore
+    orxThread_DeleteSemaphore(sstBundle.pstSemaphore);
+    sstBundle.pstSemaphore = orxNULL;
+
     // Updates status
     sstBundle.bInit = orxFALSE;
   }
@@ -1696,7 +4174,7 @@ orxBOOL orxFASTCALL orxBundle_IsProcessing()
 const orxSTRING orxFASTCALL orxBundle_GetOutputName()
 {
   // Done!
-  return (sstBundle.hResource != orxHANDLE_UNDEFINED) ? orxResource_GetPath(orxResource_GetLocation(sstBundle.hResource)) : orxSTRING_EMPTY;
+  return (sstBundle.hResource != orxHANDLE_UNDEFINED) ? orxResource_GetPath(sstBundle.acOutputLocation) : orxSTRING_EMPTY;
 }
 
 #if defined(__orxGCC__)
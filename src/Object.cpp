@@ -13,7 +13,3 @@ void Object::OnCreate()
 void Object::OnDelete()
 {
 }
-
-void Object::Update(const orxCLOCK_INFO &_rstInfo)
-{
-}
@@ -31,22 +31,41 @@ namespace py = pkpy;
 #define orxPY_KZ_CONFIG_INIT "Init"
 #define orxPY_KZ_CONFIG_UPDATE "Update"
 #define orxPY_KZ_CONFIG_EXIT "Exit"
+#define orxPY_KZ_CONFIG_FIXED_UPDATE "FixedUpdate"
+#define orxPY_KZ_CONFIG_FIXED_STEP "FixedStep"
+#define orxPY_KZ_CONFIG_MAX_SUB_STEPS "MaxSubSteps"
+#define orxPY_KZ_CONFIG_CLOCKS "Clocks"
+
+#define orxPY_KC_CLOCK_SEPARATOR '@'
 
 #define orxPY_KZ_COMMAND_EXEC "Python.Exec"
 
 #define orxPY_KZ_DEFAULT_INIT "orx_init"
 #define orxPY_KZ_DEFAULT_UPDATE "orx_update"
 #define orxPY_KZ_DEFAULT_EXIT "orx_exit"
+#define orxPY_KZ_DEFAULT_FIXED_UPDATE "orx_fixed_update"
+#define orxPY_KZ_DEFAULT_MAX_SUB_STEPS 5
 
 struct orxPYTHON_CALLBACKS
 {
   py::PyVar pyInit = nullptr;
   py::PyVar pyUpdate = nullptr;
   py::PyVar pyExit = nullptr;
+  py::PyVar pyFixedUpdate = nullptr;
+};
+
+struct orxPYTHON_FIXED_STEP
+{
+  orxFLOAT fStep = orxFLOAT_0;
+  orxFLOAT fAccumulator = orxFLOAT_0;
+  orxFLOAT fAlpha = orxFLOAT_0;
+  orxU32 u32MaxSubSteps = 0;
 };
 
 static py::VM *pVM = nullptr;
 static orxPYTHON_CALLBACKS stPyCallbacks{};
+static orxPYTHON_FIXED_STEP stPyFixedStep{};
+static std::vector<orxCLOCK *> apstPyClocks;
 
 orxCHAR *orxPy_ReadSource(const orxSTRING zPath, int *pSize)
 {
@@ -111,6 +130,32 @@ void orxPy_InitCallbacks(py::VM *vm, orxPYTHON_CALLBACKS *pstPyCallbacks)
     pstPyCallbacks->pyExit = dAttrs[zName];
   }
 
+  zName = orxConfig_HasValue(orxPY_KZ_CONFIG_FIXED_UPDATE) ? orxConfig_GetString(orxPY_KZ_CONFIG_FIXED_UPDATE) : orxPY_KZ_DEFAULT_FIXED_UPDATE;
+  if (dAttrs.contains(zName))
+  {
+    pstPyCallbacks->pyFixedUpdate = dAttrs[zName];
+  }
+
+  orxConfig_PopSection();
+}
+
+void orxPy_InitFixedStep(orxPYTHON_FIXED_STEP *pstFixedStep)
+{
+  orxConfig_PushSection(orxPY_KZ_CONFIG_SECTION);
+
+  // Get simulation step, a null step disables fixed updates
+  pstFixedStep->fStep = orxMAX(orxConfig_GetFloat(orxPY_KZ_CONFIG_FIXED_STEP), orxFLOAT_0);
+  pstFixedStep->u32MaxSubSteps = orxConfig_HasValue(orxPY_KZ_CONFIG_MAX_SUB_STEPS) ? orxConfig_GetU32(orxPY_KZ_CONFIG_MAX_SUB_STEPS) : orxPY_KZ_DEFAULT_MAX_SUB_STEPS;
+
+  // At least one sub-step per frame, or fixed updates would never run
+  if (pstFixedStep->fStep > orxFLOAT_0 && pstFixedStep->u32MaxSubSteps == 0)
+  {
+    orxLOG("[%s] %s can't be 0 when %s is set, using 1 instead.", orxPY_KZ_CONFIG_SECTION, orxPY_KZ_CONFIG_MAX_SUB_STEPS, orxPY_KZ_CONFIG_FIXED_STEP);
+    pstFixedStep->u32MaxSubSteps = 1;
+  }
+  pstFixedStep->fAccumulator = orxFLOAT_0;
+  pstFixedStep->fAlpha = orxFLOAT_0;
+
   orxConfig_PopSection();
 }
 
@@ -154,6 +199,79 @@ orxSTATUS orxPy_Call1(py::VM *vm, py::PyVar pyCallable, py::PyVar pyArg)
   return eResult;
 }
 
+void orxFASTCALL orxPy_ClockUpdate(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  // Call the Python function bound to this clock
+  orxSTATUS eResult = orxPy_Call1(pVM, (py::PyVar)_pContext, py::py_var(pVM, _pstClockInfo->fDT));
+
+  // Failed?
+  if (eResult == orxSTATUS_FAILURE)
+  {
+    // Send close event
+    orxEvent_SendShort(orxEVENT_TYPE_SYSTEM, orxSYSTEM_EVENT_CLOSE);
+  }
+}
+
+void orxPy_InitClocks(py::VM *vm)
+{
+  // Value defined in the main module referenced by name
+  py::NameDict &dAttrs = vm->_main->attr();
+
+  orxConfig_PushSection(orxPY_KZ_CONFIG_SECTION);
+
+  // For all Name@Frequency entries
+  for (orxS32 i = 0, iCount = orxConfig_GetListCount(orxPY_KZ_CONFIG_CLOCKS); i < iCount; i++)
+  {
+    const orxSTRING zEntry = orxConfig_GetListString(orxPY_KZ_CONFIG_CLOCKS, i);
+    orxS32 s32Separator = orxString_SearchCharIndex(zEntry, orxPY_KC_CLOCK_SEPARATOR, 0);
+    orxFLOAT fFrequency = orxFLOAT_0;
+
+    if (s32Separator > 0 && orxString_ToFloat(zEntry + s32Separator + 1, &fFrequency, orxNULL) != orxSTATUS_FAILURE && fFrequency > orxFLOAT_0)
+    {
+      orxCHAR acName[128];
+      orxString_NPrint(acName, sizeof(acName), "%.*s", s32Separator, zEntry);
+
+      if (dAttrs.contains(acName))
+      {
+        // Run the function on its own clock
+        orxCLOCK *pstClock = orxClock_Create(orxFLOAT_1 / fFrequency);
+        if (pstClock != orxNULL)
+        {
+          if (orxClock_Register(pstClock, orxPy_ClockUpdate, (void *)dAttrs[acName], orxMODULE_ID_MAIN, orxCLOCK_PRIORITY_NORMAL) != orxSTATUS_FAILURE)
+          {
+            apstPyClocks.push_back(pstClock);
+          }
+          else
+          {
+            orxClock_Delete(pstClock);
+          }
+        }
+      }
+      else
+      {
+        orxLOG("[Python] Clocks: function <%s> not found.", acName);
+      }
+    }
+    else
+    {
+      orxLOG("[Python] Clocks: invalid entry <%s>, expected Name@Frequency.", zEntry);
+    }
+  }
+
+  orxConfig_PopSection();
+}
+
+void orxPy_ExitClocks()
+{
+  // Stop and delete all Python clocks
+  for (orxCLOCK *pstClock : apstPyClocks)
+  {
+    orxClock_Unregister(pstClock, orxPy_ClockUpdate);
+    orxClock_Delete(pstClock);
+  }
+  apstPyClocks.clear();
+}
+
 void orxPy_CommandPyExec(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
 {
   /* Execute source */
@@ -170,7 +288,39 @@ void orxPy_CommandPyExec(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList
  */
 void orxpy::Update(const orxCLOCK_INFO &_rstClockInfo)
 {
-  orxSTATUS eResult = orxPy_Call1(pVM, stPyCallbacks.pyUpdate, py::py_var(pVM, _rstClockInfo.fDT));
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxBOOL bFixedStep = (stPyFixedStep.fStep > orxFLOAT_0 && stPyCallbacks.pyFixedUpdate != nullptr) ? orxTRUE : orxFALSE;
+
+  // Fixed step simulation?
+  if (bFixedStep)
+  {
+    py::PyVar pyStep = py::py_var(pVM, stPyFixedStep.fStep);
+    orxU32 u32SubSteps = 0;
+
+    // Run as many fixed steps as the elapsed time covers, up to the clamp
+    stPyFixedStep.fAccumulator += _rstClockInfo.fDT;
+    while (eResult != orxSTATUS_FAILURE && stPyFixedStep.fAccumulator >= stPyFixedStep.fStep && u32SubSteps < stPyFixedStep.u32MaxSubSteps)
+    {
+      eResult = orxPy_Call1(pVM, stPyCallbacks.pyFixedUpdate, pyStep);
+      stPyFixedStep.fAccumulator -= stPyFixedStep.fStep;
+      u32SubSteps++;
+    }
+
+    // Clamped? Drop the time we couldn't catch up with
+    if (stPyFixedStep.fAccumulator >= stPyFixedStep.fStep)
+    {
+      stPyFixedStep.fAccumulator = orxMath_Mod(stPyFixedStep.fAccumulator, stPyFixedStep.fStep);
+    }
+
+    // Store interpolation factor between the last two simulation states
+    stPyFixedStep.fAlpha = stPyFixedStep.fAccumulator / stPyFixedStep.fStep;
+  }
+
+  // Variable step update, optional when running a fixed step simulation
+  if (eResult != orxSTATUS_FAILURE && (stPyCallbacks.pyUpdate != nullptr || !bFixedStep))
+  {
+    eResult = orxPy_Call1(pVM, stPyCallbacks.pyUpdate, py::py_var(pVM, _rstClockInfo.fDT));
+  }
 
   // Should quit?
   if (eResult == orxSTATUS_FAILURE || orxInput_IsActive("Quit"))
@@ -229,6 +379,25 @@ namespace pythonwrapper
     RETURN_NONE;                \
   }
 
+  // Helpers
+
+  static std::vector<orxOBJECT *> apstQueryList(64);
+
+  orxSTRINGID GetGroupID(py::VM *vm, py::PyVar pyGroup)
+  {
+    return (pyGroup != vm->None) ? orxString_GetID(py::py_cast<const orxSTRING>(vm, pyGroup)) : orxSTRINGID_UNDEFINED;
+  }
+
+  py::PyVar GetObjectList(py::VM *vm, orxU32 u32Count)
+  {
+    py::List pyResult;
+    for (orxU32 i = 0; i < u32Count; i++)
+    {
+      pyResult.push_back(py::py_var(vm, PyPtr(apstQueryList[i])));
+    }
+    return py::py_var(vm, std::move(pyResult));
+  }
+
   // Function wrappers
 
   // Object functions
@@ -236,14 +405,25 @@ namespace pythonwrapper
   BIND(create_object)
   {
     ARG_VALUE(const orxSTRING, zName, 0);
-    orxOBJECT *pstObject = orxObject_CreateFromConfig(zName);
+    // Pooled sections reuse recycled instances
+    ScrollObject *poObject = orxpy::GetInstance().CreatePooledObject(zName);
+    orxOBJECT *pstObject = poObject ? poObject->GetOrxObject() : orxObject_CreateFromConfig(zName);
     RETURN_PTR_OR_NONE(pstObject);
   }
 
   BIND(delete_object)
   {
     OBJECT;
-    orxObject_Delete(pstObject);
+    ScrollObject *poObject = (ScrollObject *)orxObject_GetUserData(pstObject);
+    if (poObject && poObject->TestFlags(ScrollObject::FlagPooled))
+    {
+      // Pooled instances get recycled and keep their GUID, which from_guid will then resolve to their next spawn
+      orxpy::GetInstance().DeleteObject(poObject);
+    }
+    else
+    {
+      orxObject_Delete(pstObject);
+    }
     RETURN_NONE;
   }
 
@@ -360,6 +540,7 @@ namespace pythonwrapper
     {
       orxObject_SetPosition(pstObject, &vPosition);
     }
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
     RETURN_NONE;
   }
 
@@ -384,6 +565,7 @@ namespace pythonwrapper
     OBJECT;
     ARG_PTR_OR_NONE(orxOBJECT, pstParent, 1);
     orxObject_SetParent(pstObject, pstParent);
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
     RETURN_NONE;
   }
 
@@ -407,6 +589,7 @@ namespace pythonwrapper
     OBJECT;
     ARG_PTR(orxOBJECT, pstParent, 1);
     orxObject_Attach(pstObject, (void *)pstParent);
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
     RETURN_NONE;
   }
 
@@ -414,6 +597,7 @@ namespace pythonwrapper
   {
     OBJECT;
     orxObject_Detach(pstObject);
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
     RETURN_NONE;
   }
 
@@ -525,6 +709,7 @@ namespace pythonwrapper
     {
       orxObject_SetSpeed(pstObject, &vSpeed);
     }
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
     RETURN_NONE;
   }
 
@@ -634,6 +819,128 @@ namespace pythonwrapper
     }
   }
 
+  BIND(raycast_many)
+  {
+    ARG_VALUE(py::List &, pyBegins, 0);
+    ARG_VALUE(py::List &, pyEnds, 1);
+    ARG_VALUE(orxU16, u16SelfFlags, 2);
+    ARG_VALUE(orxU16, u16CheckMask, 3);
+    ARG_VALUE(orxBOOL, bEarlyExit, 4);
+    if (pyBegins.size() != pyEnds.size())
+    {
+      vm->ValueError("begins and ends must have the same length");
+    }
+    py::List pyHits, pyContacts, pyNormals;
+    for (int i = 0; i < pyBegins.size(); i++)
+    {
+      orxVECTOR &vBegin = py::py_cast<orxVECTOR &>(vm, pyBegins[i]);
+      orxVECTOR &vEnd = py::py_cast<orxVECTOR &>(vm, pyEnds[i]);
+      orxVECTOR vContact;
+      orxVECTOR vNormal;
+      orxOBJECT *pstDetected = orxObject_Raycast(&vBegin, &vEnd, u16SelfFlags, u16CheckMask, bEarlyExit, &vContact, &vNormal);
+      if (pstDetected != orxNULL)
+      {
+        pyHits.push_back(py::py_var(vm, PyPtr(pstDetected)));
+        pyContacts.push_back(py::py_var(vm, vContact));
+        pyNormals.push_back(py::py_var(vm, vNormal));
+      }
+      else
+      {
+        pyHits.push_back(vm->None);
+        pyContacts.push_back(vm->None);
+        pyNormals.push_back(vm->None);
+      }
+    }
+    RETURN_VALUE(py::Tuple(py::py_var(vm, std::move(pyHits)), py::py_var(vm, std::move(pyContacts)), py::py_var(vm, std::move(pyNormals))));
+  }
+
+  BIND(find_in_box)
+  {
+    ARG_VALUE(orxVECTOR, vMin, 0);
+    ARG_VALUE(orxVECTOR, vMax, 1);
+    orxSTRINGID stGroupID = GetGroupID(vm, args[2]);
+    orxAABOX stBox;
+    orxAABox_Set(&stBox, &vMin, &vMax);
+    orxU32 u32Count = orxpy::GetInstance().FindObjects(stBox, apstQueryList.data(), (orxU32)apstQueryList.size(), stGroupID);
+    if (u32Count > apstQueryList.size())
+    {
+      // Grows buffer and queries again
+      apstQueryList.resize(u32Count);
+      u32Count = orxpy::GetInstance().FindObjects(stBox, apstQueryList.data(), (orxU32)apstQueryList.size(), stGroupID);
+    }
+    return GetObjectList(vm, u32Count);
+  }
+
+  BIND(find_in_circle)
+  {
+    ARG_VALUE(orxVECTOR, vCenter, 0);
+    ARG_VALUE(orxFLOAT, fRadius, 1);
+    orxSTRINGID stGroupID = GetGroupID(vm, args[2]);
+    orxU32 u32Count = orxpy::GetInstance().FindObjects(vCenter, fRadius, apstQueryList.data(), (orxU32)apstQueryList.size(), stGroupID);
+    if (u32Count > apstQueryList.size())
+    {
+      // Grows buffer and queries again
+      apstQueryList.resize(u32Count);
+      u32Count = orxpy::GetInstance().FindObjects(vCenter, fRadius, apstQueryList.data(), (orxU32)apstQueryList.size(), stGroupID);
+    }
+    return GetObjectList(vm, u32Count);
+  }
+
+  BIND(find_nearest)
+  {
+    ARG_VALUE(orxVECTOR, vPosition, 0);
+    ARG_VALUE(orxS32, s32Number, 1);
+    orxSTRINGID stGroupID = GetGroupID(vm, args[2]);
+    orxFLOAT fMaxDistance = (args[3] != vm->None) ? py::py_cast<orxFLOAT>(vm, args[3]) : orxFLOAT_MAX;
+    // Can't find more objects than there are
+    orxU32 u32Number = (s32Number > 0) ? orxMIN((orxU32)s32Number, orxStructure_GetCount(orxSTRUCTURE_ID_OBJECT)) : 0;
+    if (u32Number > apstQueryList.size())
+    {
+      apstQueryList.resize(u32Number);
+    }
+    orxU32 u32Count = orxpy::GetInstance().FindNearestObjects(vPosition, apstQueryList.data(), u32Number, stGroupID, fMaxDistance);
+    return GetObjectList(vm, u32Count);
+  }
+
+  BIND(mark_moved)
+  {
+    OBJECT;
+    orxpy::GetInstance().MarkSpatialObject(pstObject);
+    RETURN_NONE;
+  }
+
+  BIND(pick_many)
+  {
+    ARG_VALUE(py::List &, pyPositions, 0);
+    orxSTRINGID stGroupID = GetGroupID(vm, args[1]);
+    py::List pyResult;
+    for (int i = 0; i < pyPositions.size(); i++)
+    {
+      orxVECTOR &vPosition = py::py_cast<orxVECTOR &>(vm, pyPositions[i]);
+      orxOBJECT *pstPicked = orxObject_Pick(&vPosition, stGroupID);
+      pyResult.push_back((pstPicked != orxNULL) ? py::py_var(vm, PyPtr(pstPicked)) : vm->None);
+    }
+    RETURN_VALUE(std::move(pyResult));
+  }
+
+  BIND(get_objects)
+  {
+    ARG_VALUE(const orxSTRING, zSection, 0);
+    // Walks the packed list of the class bound to this section, which also holds other models bound to the same class and free pooled instances
+    orxpy &roGame = orxpy::GetInstance();
+    orxU32 u32Count = roGame.GetObjectCount(zSection);
+    py::List pyResult;
+    for (orxU32 i = 0; i < u32Count; i++)
+    {
+      ScrollObject *poObject = roGame.GetObjectAt(zSection, i);
+      if (!poObject->IsFreeInPool() && !orxString_Compare(poObject->GetModelName(), zSection))
+      {
+        pyResult.push_back(py::py_var(vm, PyPtr(poObject->GetOrxObject())));
+      }
+    }
+    RETURN_VALUE(std::move(pyResult));
+  }
+
   BIND(set_text_string)
   {
     OBJECT;
@@ -1170,6 +1477,18 @@ namespace pythonwrapper
     RETURN_VALUE(orxInput_ResetValue(zName));
   }
 
+  // Clock
+
+  BIND(get_fixed_step)
+  {
+    RETURN_VALUE(stPyFixedStep.fStep);
+  }
+
+  BIND(get_fixed_alpha)
+  {
+    RETURN_VALUE(stPyFixedStep.fAlpha);
+  }
+
   // Type wrappers
 
   py::PyVar vector_new(py::VM *vm, py::ArgsView args)
@@ -1311,6 +1630,15 @@ void orxPy_AddObjectModule(py::VM *vm)
 
   vm->bind(mod, "raycast(begin: Vector, end: Vector, self_flags: int, check_mask: int, early_exit: bool = False) -> tuple[Object, Vector, Vector] | None", raycast);
 
+  vm->bind(mod, "raycast_many(begins: list[Vector], ends: list[Vector], self_flags: int, check_mask: int, early_exit: bool = False) -> tuple[list[Object | None], list[Vector | None], list[Vector | None]]", raycast_many);
+
+  vm->bind(mod, "find_in_box(min: Vector, max: Vector, group: str | None = None) -> list[Object]", find_in_box);
+  vm->bind(mod, "find_in_circle(center: Vector, radius: float, group: str | None = None) -> list[Object]", find_in_circle);
+  vm->bind(mod, "find_nearest(position: Vector, count: int, group: str | None = None, max_distance: float | None = None) -> list[Object]", find_nearest);
+  vm->bind(mod, "mark_moved(o: Object) -> None", mark_moved);
+  vm->bind(mod, "pick_many(positions: list[Vector], group: str | None = None) -> list[Object | None]", pick_many);
+  vm->bind(mod, "get_objects(section: str) -> list[Object]", get_objects);
+
   vm->bind(mod, "set_text_string(o: Object, s: str) -> None", set_text_string);
   vm->bind(mod, "get_text_string(o: Object) -> str", get_text_string);
 
@@ -1422,6 +1750,18 @@ void orxPy_AddInputModule(py::VM *vm)
   vm->bind(mod, "reset_value(name: str) -> None", reset_value);
 }
 
+void orxPy_AddClockModule(py::VM *vm)
+{
+  // Register clock module
+  py::PyVar mod = vm->new_module("clock");
+
+  using namespace pythonwrapper;
+
+  // Bind clock functions
+  vm->bind(mod, "get_fixed_step() -> float", get_fixed_step);
+  vm->bind(mod, "get_alpha() -> float", get_fixed_alpha);
+}
+
 void orxPy_AddModules(py::VM *vm)
 {
   orxPy_AddVectorModule(vm);
@@ -1429,6 +1769,7 @@ void orxPy_AddModules(py::VM *vm)
   orxPy_AddCommandModule(vm);
   orxPy_AddInputModule(vm);
   orxPy_AddObjectModule(vm);
+  orxPy_AddClockModule(vm);
 }
 
 orxSTATUS orxPy_InitVM(py::VM *&vm)
@@ -1480,6 +1821,8 @@ orxSTATUS orxpy::Init()
   if (eResult == orxSTATUS_SUCCESS)
   {
     orxPy_InitCallbacks(pVM, &stPyCallbacks);
+    orxPy_InitFixedStep(&stPyFixedStep);
+    orxPy_InitClocks(pVM);
     orxCOMMAND_REGISTER(orxPY_KZ_COMMAND_EXEC, orxPy_CommandPyExec, "Result", orxCOMMAND_VAR_TYPE_STRING, 1, 0, {"Source", orxCOMMAND_VAR_TYPE_STRING});
     eResult = orxPy_Call(pVM, stPyCallbacks.pyInit);
   }
@@ -1502,6 +1845,9 @@ void orxpy::Exit()
 {
   orxPy_Call(pVM, stPyCallbacks.pyExit);
 
+  // Delete Python clocks
+  orxPy_ExitClocks();
+
   // Exit from extensions
   ExitExtensions();
 